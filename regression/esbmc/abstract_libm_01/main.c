@@ -0,0 +1,18 @@
+#include <assert.h>
+#include <math.h>
+
+double nondet_double();
+
+int main()
+{
+  double x = nondet_double();
+  __ESBMC_assume(x >= -10.0 && x <= 10.0);
+
+  double s = 0.0;
+  for(int i = 0; i < 10; i++)
+    s += sin(x + i) * cos(x - i);
+
+  assert(s >= -10.0 && s <= 10.0);
+  assert(fmod(x, 3.0) < 3.0);
+  return 0;
+}
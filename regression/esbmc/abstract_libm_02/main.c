@@ -0,0 +1,14 @@
+#include <assert.h>
+#include <math.h>
+
+double nondet_double();
+
+int main()
+{
+  double x = nondet_double();
+  __ESBMC_assume(x > 0.0 && x < 1.0);
+
+  // Only the range of sin is known, not its value
+  assert(sin(x) < 0.5);
+  return 0;
+}
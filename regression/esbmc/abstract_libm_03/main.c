@@ -0,0 +1,23 @@
+#include <assert.h>
+#include <math.h>
+
+float nondet_float();
+
+int main()
+{
+  float a = nondet_float(), b = nondet_float();
+  __ESBMC_assume(a >= 0.0f && a <= b && b <= 10.0f);
+
+  // Consecutive calls are ordered like their arguments
+  float ea = expf(a);
+  float eb = expf(b);
+  assert(ea >= 1.0f && ea <= eb);
+
+  double l = log(2.0);
+  assert(l >= 0.0 && l <= 1.0);
+
+  assert(signbit(sin(-0.0)));
+  assert(tanf(0.5f) >= 0.5f);
+  assert(acosl(-0.5L) >= 1.5L);
+  return 0;
+}
@@ -0,0 +1,29 @@
+#include <assert.h>
+
+int nondet_int();
+
+int main()
+{
+  int a[64];
+  int k = nondet_int();
+
+  // Not constant as a whole, but every element written below is known
+  a[63] = k;
+  for(int i = 0; i < 63; i++)
+    a[i] = i * 3;
+
+  int sum = 0;
+  for(int i = 0; i < 63; i++)
+    sum += a[i];
+
+  assert(sum == 5859);
+
+  if(k > 0)
+    a[5] = 1;
+  else
+    a[5] = 1;
+
+  assert(a[5] == 1 && a[6] == 18);
+  assert(a[63] == 0);
+  return 0;
+}
@@ -0,0 +1,33 @@
+#include <assert.h>
+
+struct pair
+{
+  int v[2];
+};
+
+int nondet_int();
+
+int main()
+{
+  struct pair p, q;
+  p.v[0] = 1;
+  p.v[1] = nondet_int();
+
+  // Both refer to the version of p before the stores below
+  q = p;
+  int old = p.v[0];
+
+  p.v[0] = 7;
+  p.v[1] = 8;
+
+  assert(old == 1);
+  assert(q.v[0] == 1);
+  assert(p.v[0] == 7 && p.v[1] == 8);
+
+  int a[4] = {3, 4, 5, 6};
+  int *o = &a[0];
+  int first = a[0];
+  a[0] = 9;
+  assert(first == 3 && *o == 9 && a[1] == 4);
+  return 0;
+}
@@ -0,0 +1,18 @@
+int last;
+
+int add(int x, int y)
+{
+  __ESBMC_requires(x >= 0 && x <= 100);
+  __ESBMC_requires(y >= 0 && y <= 100);
+  __ESBMC_ensures(__ESBMC_return_value == x + y);
+  __ESBMC_ensures(last == x);
+  __ESBMC_assigns(&last);
+
+  last = x;
+  return x + y;
+}
+
+int main()
+{
+  return add(1, 2);
+}
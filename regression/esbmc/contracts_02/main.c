@@ -0,0 +1,15 @@
+int last, count;
+
+void record(int x)
+{
+  __ESBMC_assigns(&last);
+
+  last = x;
+  count++;
+}
+
+int main()
+{
+  record(1);
+  return 0;
+}
@@ -0,0 +1,19 @@
+unsigned int nondet_uint();
+
+unsigned int sum(unsigned int n)
+{
+  __ESBMC_requires(n < 1000);
+  __ESBMC_ensures(__ESBMC_return_value == n * (n + 1) / 2);
+
+  unsigned int s = 0;
+  for(unsigned int i = 1; i <= n; i++)
+    s += i;
+  return s;
+}
+
+int main()
+{
+  unsigned int n = nondet_uint();
+  unsigned int s = sum(n);
+  return 0;
+}
@@ -0,0 +1,21 @@
+double total;
+
+double scale(double x)
+{
+  __ESBMC_requires(x >= 0.0 && x <= 1.0);
+  __ESBMC_ensures(__ESBMC_return_value == x / 2);
+  __ESBMC_ensures(total == x);
+  __ESBMC_assigns(&total);
+
+  // Writes through pointers to locals are outside the frame condition
+  double half;
+  double *p = &half;
+  *p = x / 2;
+  total = x;
+  return half;
+}
+
+int main()
+{
+  return scale(0.5) > 0;
+}
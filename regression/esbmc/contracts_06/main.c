@@ -0,0 +1,15 @@
+unsigned int depth(unsigned int n)
+{
+  __ESBMC_requires(n <= 3);
+  __ESBMC_ensures(__ESBMC_return_value == n);
+
+  if(n == 0)
+    return 0;
+  // Each frame checks against its own value of n on entry
+  return depth(n - 1) + 1;
+}
+
+int main()
+{
+  return depth(2);
+}
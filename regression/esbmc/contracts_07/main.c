@@ -0,0 +1,13 @@
+long long widen(int x)
+{
+  __ESBMC_requires(x == 300);
+  // Explicit conversions of the return value must still be applied
+  __ESBMC_ensures((unsigned char)__ESBMC_return_value == 44);
+
+  return x;
+}
+
+int main()
+{
+  return widen(300) > 0;
+}
@@ -0,0 +1,13 @@
+double halve(int x)
+{
+  __ESBMC_requires(x == 3);
+  __ESBMC_ensures((int)__ESBMC_return_value == 1);
+  __ESBMC_ensures(__ESBMC_return_value == 1.5);
+
+  return x / 2.0;
+}
+
+int main()
+{
+  return halve(3) > 0;
+}
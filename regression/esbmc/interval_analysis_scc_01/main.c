@@ -0,0 +1,21 @@
+int g;
+
+int inc(int x)
+{
+  g = g + 1;
+  return x + 1;
+}
+
+int twice(int x)
+{
+  return inc(inc(x));
+}
+
+int main()
+{
+  int a = twice(1);
+  int b = inc(a);
+  __ESBMC_assert(g == 3, "three increments");
+  __ESBMC_assert(b == 4, "b is four");
+  return 0;
+}
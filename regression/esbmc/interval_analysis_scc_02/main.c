@@ -0,0 +1,40 @@
+int g, h;
+
+int row(int i)
+{
+  int sum = 0;
+  for(int j = 0; j < 3; j++)
+  {
+    g = g + 1;
+    sum += i * j;
+  }
+  return sum;
+}
+
+int col(int k)
+{
+  int prod = 1;
+  for(int j = 0; j < k; j++)
+  {
+    h = h + 1;
+    prod *= 2;
+  }
+  return prod;
+}
+
+int main()
+{
+  int total = 0;
+  for(int i = 0; i < 3; i++)
+  {
+    for(int k = 0; k < 2; k++)
+    {
+      // row and col are independent components, analysed side by side
+      total += row(i) + col(k);
+      // Only reached on the last iterations of both loops
+      if(i == 2 && k == 1)
+        __ESBMC_assert(total != 27, "total is twenty-seven");
+    }
+  }
+  return g + h;
+}
@@ -0,0 +1,15 @@
+int nondet_int();
+
+int main()
+{
+  int x = nondet_int();
+  __ESBMC_assume(x >= 0);
+  __ESBMC_assume(x <= 100);
+
+  int sum = 0;
+  for(int i = 0; i < 10; i++)
+    sum = sum + x;
+
+  assert(sum == 10 * x);
+  return 0;
+}
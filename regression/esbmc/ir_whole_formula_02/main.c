@@ -0,0 +1,10 @@
+unsigned int nondet_uint();
+
+int main()
+{
+  unsigned int x = nondet_uint();
+  unsigned int y = x & 0xff;
+  assert(y <= 255);
+  assert(y != 42);
+  return 0;
+}
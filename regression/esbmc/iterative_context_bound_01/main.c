@@ -0,0 +1,23 @@
+#include <assert.h>
+#include <pthread.h>
+
+int x = 0;
+
+void *t(void *arg)
+{
+  int tmp = x;
+  x = tmp + 1;
+  return NULL;
+}
+
+int main()
+{
+  pthread_t t1, t2;
+  pthread_create(&t1, NULL, t, NULL);
+  pthread_create(&t2, NULL, t, NULL);
+  pthread_join(t1, NULL);
+  pthread_join(t2, NULL);
+  // Fails once t2 preempts t1 between the read and the write
+  assert(x == 2);
+  return 0;
+}
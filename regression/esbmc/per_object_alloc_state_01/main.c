@@ -0,0 +1,31 @@
+#include <stdlib.h>
+
+struct node
+{
+  int data;
+  struct node *next;
+};
+
+int main()
+{
+  struct node *head = NULL;
+  for(int i = 0; i < 8; i++)
+  {
+    struct node *n = malloc(sizeof(struct node));
+    if(n == NULL)
+      break;
+    n->data = i;
+    n->next = head;
+    head = n;
+  }
+
+  // Frees all but the last node
+  while(head != NULL && head->next != NULL)
+  {
+    struct node *next = head->next;
+    free(head);
+    head = next;
+  }
+
+  return 0;
+}
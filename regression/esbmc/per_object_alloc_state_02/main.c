@@ -0,0 +1,17 @@
+#include <stdlib.h>
+
+int main()
+{
+  int *p = malloc(2 * sizeof(int));
+  if(p == NULL)
+    return 0;
+  p[0] = 1;
+
+  int *q = realloc(p, 4 * sizeof(int));
+  if(q == NULL)
+    return 0;
+  q[3] = 2;
+
+  // p was freed by realloc
+  return p[0];
+}
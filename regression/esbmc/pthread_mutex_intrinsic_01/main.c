@@ -0,0 +1,25 @@
+#include <assert.h>
+#include <pthread.h>
+
+pthread_mutex_t m = PTHREAD_MUTEX_INITIALIZER;
+int x = 0;
+
+void *t(void *arg)
+{
+  pthread_mutex_lock(&m);
+  int tmp = x;
+  x = tmp + 1;
+  pthread_mutex_unlock(&m);
+  return NULL;
+}
+
+int main()
+{
+  pthread_t t1, t2;
+  pthread_create(&t1, NULL, t, NULL);
+  pthread_create(&t2, NULL, t, NULL);
+  pthread_join(t1, NULL);
+  pthread_join(t2, NULL);
+  assert(x == 2);
+  return 0;
+}
@@ -0,0 +1,31 @@
+#include <assert.h>
+
+int counter;
+
+void add_one(int n)
+{
+  counter += 1;
+}
+
+void add_n(int n)
+{
+  counter += n;
+}
+
+void (*handlers[2])(int) = {add_one, add_n};
+
+int nondet_int();
+
+int main()
+{
+  void (*single)(int) = add_one;
+  single(5);
+  assert(counter == 1);
+
+  int i = nondet_int();
+  __ESBMC_assume(i >= 0 && i < 2);
+  handlers[i](3);
+  assert(counter == 2 || counter == 4);
+  assert(counter == 2);
+  return 0;
+}
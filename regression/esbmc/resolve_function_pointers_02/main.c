@@ -0,0 +1,28 @@
+#include <assert.h>
+#include <pthread.h>
+
+int add_one(int x)
+{
+  return x + 1;
+}
+
+int add_n(int x)
+{
+  return x + 5;
+}
+
+int (*fp)(int) = add_one;
+
+void *worker(void *arg)
+{
+  fp = add_n;
+  return NULL;
+}
+
+int main()
+{
+  pthread_t t;
+  pthread_create(&t, NULL, worker, NULL);
+  assert(fp(1) == 2);
+  return 0;
+}
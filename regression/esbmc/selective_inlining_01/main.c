@@ -0,0 +1,36 @@
+#include <assert.h>
+
+int counter;
+
+static int add(int a, int b)
+{
+  return a + b;
+}
+
+static void bump(int *p)
+{
+  *p = add(*p, 1);
+}
+
+int fact(int n)
+{
+  if(n <= 1)
+    return 1;
+  return n * fact(n - 1);
+}
+
+int main()
+{
+  int x = 0;
+  for(int i = 0; i < 4; i++)
+  {
+    bump(&x);
+    counter = add(counter, i);
+  }
+
+  assert(x == 4);
+  assert(counter == 6);
+  assert(fact(3) == 6);
+  assert(add(x, counter) == 11);
+  return 0;
+}
@@ -0,0 +1,11 @@
+int nondet_int();
+
+int main()
+{
+  int x = nondet_int();
+  int y = nondet_int();
+  __ESBMC_assume(x > 0 && x < 100);
+  __ESBMC_assume(y > 0 && y < 100);
+  assert(x * y != 42);
+  return 0;
+}
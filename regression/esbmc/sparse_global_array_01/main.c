@@ -0,0 +1,18 @@
+#include <assert.h>
+
+const unsigned char table[65536] = {[1] = 3, [100] = 7, [65535] = 9};
+int buffer[4096];
+
+unsigned int nondet_uint();
+
+int main()
+{
+  unsigned int i = nondet_uint();
+  __ESBMC_assume(i < 65536);
+
+  assert(table[100] == 7 && table[101] == 0);
+  buffer[10] = table[1];
+  assert(buffer[10] == 3 && buffer[11] == 0);
+  assert(table[i] != 9);
+  return 0;
+}
@@ -0,0 +1,20 @@
+#include <assert.h>
+
+unsigned int table[4096];
+
+unsigned int nondet_uint();
+
+int main()
+{
+  // Many more updates of the zero-initialised table than are propagated
+  for(unsigned int i = 0; i < 256; i++)
+    table[i] = i * i;
+
+  unsigned int j = nondet_uint();
+  __ESBMC_assume(j < 256);
+
+  assert(table[15] == 225 && table[300] == 0);
+  assert(table[j] == j * j);
+  assert(table[255] == 0);
+  return 0;
+}
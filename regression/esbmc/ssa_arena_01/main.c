@@ -0,0 +1,18 @@
+#include <assert.h>
+
+int nondet_int();
+
+int main()
+{
+  int x = 0, sum = 0;
+  while(1)
+  {
+    int y = nondet_int();
+    __ESBMC_assume(y >= 0 && y < 10);
+    sum += y;
+    x++;
+    // Only reachable after a few rounds of incremental unwinding
+    assert(x < 4 || sum != 30);
+  }
+  return 0;
+}
@@ -0,0 +1,26 @@
+#include <assert.h>
+#include <pthread.h>
+
+#define N 4
+
+pthread_mutex_t m = PTHREAD_MUTEX_INITIALIZER;
+int x = 0;
+
+void *worker(void *arg)
+{
+  pthread_mutex_lock(&m);
+  x++;
+  pthread_mutex_unlock(&m);
+  return NULL;
+}
+
+int main()
+{
+  pthread_t t[N];
+  for(int i = 0; i < N; i++)
+    pthread_create(&t[i], NULL, worker, NULL);
+  for(int i = 0; i < N; i++)
+    pthread_join(t[i], NULL);
+  assert(x == N);
+  return 0;
+}
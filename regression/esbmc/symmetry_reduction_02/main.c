@@ -0,0 +1,24 @@
+#include <assert.h>
+#include <pthread.h>
+
+#define N 3
+
+int x = 0;
+
+void *worker(void *arg)
+{
+  int tmp = x;
+  x = tmp + 1;
+  return NULL;
+}
+
+int main()
+{
+  pthread_t t[N];
+  for(int i = 0; i < N; i++)
+    pthread_create(&t[i], NULL, worker, NULL);
+  for(int i = 0; i < N; i++)
+    pthread_join(t[i], NULL);
+  assert(x == N);
+  return 0;
+}
@@ -0,0 +1,30 @@
+#include <assert.h>
+#include <pthread.h>
+
+#define N 2
+
+pthread_mutex_t m = PTHREAD_MUTEX_INITIALIZER;
+long next = 0;
+
+void *worker(void *arg)
+{
+  pthread_mutex_lock(&m);
+  long ticket = next++;
+  pthread_mutex_unlock(&m);
+  return (void *)ticket;
+}
+
+int main()
+{
+  pthread_t t[N];
+  for(int i = 0; i < N; i++)
+    pthread_create(&t[i], NULL, worker, NULL);
+
+  // The workers are identical, but their results are told apart by the
+  // order of their IDs: the second one may well take the first ticket
+  void *first, *second;
+  pthread_join(t[0], &first);
+  pthread_join(t[1], &second);
+  assert((long)first < (long)second);
+  return 0;
+}
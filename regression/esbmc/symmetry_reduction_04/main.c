@@ -0,0 +1,30 @@
+#include <assert.h>
+#include <pthread.h>
+
+int ticket = 0;
+int leader_done = 0;
+
+void *worker(void *arg)
+{
+  int me;
+  __ESBMC_atomic_begin();
+  me = ticket++;
+  __ESBMC_atomic_end();
+
+  if(me == 0)
+    leader_done = 1;
+  return NULL;
+}
+
+int main()
+{
+  pthread_t a, b;
+  pthread_create(&a, NULL, worker, NULL);
+  pthread_create(&b, NULL, worker, NULL);
+
+  // The workers are identical, but joining a waits for that thread in
+  // particular, which need not be the one that took the first ticket
+  pthread_join(a, NULL);
+  assert(leader_done);
+  return 0;
+}
@@ -0,0 +1,26 @@
+#include <assert.h>
+#include <stdbool.h>
+
+unsigned int nondet_uint();
+_Bool nondet_bool();
+
+int main()
+{
+  unsigned int x = nondet_uint();
+  _Bool a = nondet_bool(), b = nondet_bool();
+
+  // Byte slices of the same word, glued back together
+  unsigned char lo = x, hi = x >> 8;
+  unsigned short both = ((unsigned short)hi << 8) | lo;
+  assert(both == (unsigned short)x);
+
+  // Boolean glue that folds away
+  assert((a && !a) == false);
+  assert((a || true) == true);
+  assert((a ? true : b) == (a || b));
+  assert((!a ? b : false) == (!a && b));
+
+  // ... and one that reaches the solver
+  assert((a ^ b) == (a != b));
+  return 0;
+}
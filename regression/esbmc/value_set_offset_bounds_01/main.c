@@ -0,0 +1,22 @@
+#include <assert.h>
+
+struct s
+{
+  int a;
+  int b;
+  int c;
+  int d;
+};
+
+int nondet_int();
+
+int main()
+{
+  struct s x = {1, 2, 3, 4};
+  int *p = nondet_int() ? &x.b : &x.c;
+  *p = 5;
+  assert(x.a == 1 && x.d == 4);
+  assert(x.b == 5 || x.c == 5);
+  assert(x.b == 2);
+  return 0;
+}
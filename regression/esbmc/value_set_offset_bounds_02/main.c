@@ -0,0 +1,27 @@
+#include <assert.h>
+
+struct pt
+{
+  int x;
+  int y;
+};
+
+int nondet_int();
+
+int main()
+{
+  struct pt a[4] = {{0, 1}, {2, 3}, {4, 5}, {6, 7}};
+  int *p = nondet_int() ? &a[2].x : &a[2].y;
+  *p = 9;
+  assert(a[2].x == 9 || a[2].y == 9);
+  assert(a[1].y == 3 && a[3].x == 6);
+
+  int m[3][4] = {0};
+  int *q = nondet_int() ? &m[1][0] : &m[1][3];
+  *q = 1;
+  assert(m[1][0] + m[1][3] == 1);
+  assert(m[0][3] == 0 && m[2][0] == 0);
+
+  assert(a[2].x == 4);
+  return 0;
+}
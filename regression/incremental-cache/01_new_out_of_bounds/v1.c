@@ -0,0 +1,9 @@
+int nondet_int();
+
+int main()
+{
+  int a[4] = {0, 1, 2, 3};
+  int i = nondet_int();
+  __ESBMC_assume(i >= 0 && i <= 3);
+  return a[i];
+}
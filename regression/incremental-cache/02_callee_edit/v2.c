@@ -0,0 +1,12 @@
+#include <assert.h>
+
+int twice(int x)
+{
+  return x + x + 1;
+}
+
+int main()
+{
+  assert(twice(3) == 6);
+  return 0;
+}
@@ -0,0 +1,19 @@
+#include <assert.h>
+#include <pthread.h>
+
+int x = 0;
+
+void *worker(void *arg)
+{
+  x = 2;
+  return NULL;
+}
+
+int main()
+{
+  pthread_t t;
+  pthread_create(&t, NULL, worker, NULL);
+  pthread_join(t, NULL);
+  assert(x == 1);
+  return 0;
+}
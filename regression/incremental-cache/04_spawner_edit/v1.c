@@ -0,0 +1,20 @@
+#include <assert.h>
+#include <pthread.h>
+
+int x = 0;
+
+void *worker(void *arg)
+{
+  // The claim is in the thread, and depends on what main did before
+  assert(x == 1);
+  return NULL;
+}
+
+int main()
+{
+  pthread_t t;
+  x = 1;
+  pthread_create(&t, NULL, worker, NULL);
+  pthread_join(t, NULL);
+  return 0;
+}
@@ -0,0 +1,12 @@
+#include <assert.h>
+
+int square(int x)
+{
+  return x * x;
+}
+
+int main()
+{
+  assert(square(3) == 9);
+  return 0;
+}
@@ -0,0 +1,41 @@
+# Runs ESBMC on two versions of a program sharing one --incremental-cache
+# file, as a developer editing the program between two runs would.
+#
+# TEST_DIR holds v1.c, v2.c and test.desc: the first line of test.desc has
+# the arguments of both runs, the following lines regexes that the output of
+# the second run must match. The first run must verify successfully, so that
+# its verdicts end up in the cache. WORK_DIR receives the cache file.
+
+cmake_policy(SET CMP0007 NEW)
+
+file(REMOVE_RECURSE ${WORK_DIR})
+file(MAKE_DIRECTORY ${WORK_DIR})
+set(CACHE_FILE ${WORK_DIR}/verdicts.cache)
+
+file(READ ${TEST_DIR}/test.desc DESC)
+string(REGEX REPLACE "\n+$" "" DESC "${DESC}")
+string(REPLACE "\n" ";" DESC "${DESC}")
+list(GET DESC 0 ARGS)
+list(REMOVE_AT DESC 0)
+separate_arguments(ARGS)
+
+foreach(VERSION v1 v2)
+  execute_process(
+    COMMAND ${ESBMC} ${TEST_DIR}/${VERSION}.c ${ARGS}
+            --incremental-cache ${CACHE_FILE}
+    OUTPUT_VARIABLE OUT
+    ERROR_VARIABLE ERR)
+  set(OUT "${OUT}${ERR}")
+
+  if(VERSION STREQUAL "v1")
+    if(NOT OUT MATCHES "VERIFICATION SUCCESSFUL")
+      message(FATAL_ERROR "First run did not verify:\n${OUT}")
+    endif()
+  else()
+    foreach(REGEX IN LISTS DESC)
+      if(NOT OUT MATCHES "${REGEX}")
+        message(FATAL_ERROR "Second run does not match ${REGEX}:\n${OUT}")
+      endif()
+    endforeach()
+  endif()
+endforeach()
@@ -0,0 +1,287 @@
+#define __CRT__NO_INLINE /* Don't let mingw insert code */
+
+#ifdef _MSVC
+#define _USE_MATH_DEFINES
+#define _CRT_FUNCTIONS_REQUIRED 0
+#endif
+#include <math.h>
+
+float nondet_float();
+double nondet_double();
+long double nondet_ldouble();
+
+/* Models used instead of the precise ones with --abstract-libm. Rather than
+ * computing the result, they return any value satisfying properties of the
+ * exact function that survive correct rounding: the range of the function,
+ * its sign, its special cases, the points where it is exact, simple bounds
+ * such as exp(x) >= 1 + x, and monotonicity. Whatever is proven with them
+ * holds for the precise models too, but a counterexample may rely on a result
+ * the real function never returns.
+ *
+ * Each model comes in a float, double and long double flavour. The constants
+ * are rounded to the type: a correctly rounded acosf(-1) is (float)pi, which
+ * lies above pi. Where the sign of a result changes at one of them, the
+ * comparison is strict, so it holds whichever way the constant was rounded.
+ *
+ * Monotonicity is only stated with respect to the previous call of the same
+ * function, whose argument and result each model remembers. That is enough
+ * for the common pattern of comparing f(a) with f(b), and keeps the models
+ * free of quantifiers. */
+
+#define ABSTRACT_PI 3.14159265358979323846264338327950288L
+#define ABSTRACT_PI_2 1.57079632679489661923132169163975144L
+
+/* Assume r relates to the result of the previous call the way x relates to
+ * its argument, or the other way round when dir is negative. */
+#define abstract_monotone(type, x, r, dir)                                     \
+  do                                                                           \
+  {                                                                            \
+    static _Bool called = 0;                                                   \
+    static type last_x, last_r;                                                \
+    if(called)                                                                 \
+    {                                                                          \
+      if(x <= last_x)                                                          \
+        __ESBMC_assume(dir > 0 ? r <= last_r : r >= last_r);                   \
+      if(x >= last_x)                                                          \
+        __ESBMC_assume(dir > 0 ? r >= last_r : r <= last_r);                   \
+    }                                                                          \
+    called = 1;                                                                \
+    last_x = x;                                                                \
+    last_r = r;                                                                \
+  } while(0)
+
+#define sin_abstract_def(type, name, fabs_func, nondet_func)                   \
+  type name(type x)                                                            \
+  {                                                                            \
+  __ESBMC_HIDE:;                                                               \
+    if(isnan(x) || isinf(x))                                                   \
+      return NAN;                                                              \
+                                                                               \
+    /* sin(+-0) = +-0 */                                                       \
+    if(x == 0.0)                                                               \
+      return x;                                                                \
+                                                                               \
+    type r = nondet_func();                                                    \
+    __ESBMC_assume(r >= -1.0 && r <= 1.0);                                     \
+    /* |sin(x)| <= |x| */                                                      \
+    __ESBMC_assume(fabs_func(r) <= fabs_func(x));                              \
+    /* sin is non-negative on [0, pi] and odd */                               \
+    if(x > 0.0 && x < (type)ABSTRACT_PI)                                       \
+      __ESBMC_assume(r >= 0.0);                                                \
+    if(x < 0.0 && x > -(type)ABSTRACT_PI)                                      \
+      __ESBMC_assume(r <= 0.0);                                                \
+    return r;                                                                  \
+  }
+
+sin_abstract_def(float, sinf_abstract, fabsf, nondet_float);
+sin_abstract_def(double, sin_abstract, fabs, nondet_double);
+sin_abstract_def(long double, sinl_abstract, fabsl, nondet_ldouble);
+
+#define cos_abstract_def(type, name, fabs_func, nondet_func)                   \
+  type name(type x)                                                            \
+  {                                                                            \
+  __ESBMC_HIDE:;                                                               \
+    if(isnan(x) || isinf(x))                                                   \
+      return NAN;                                                              \
+                                                                               \
+    if(x == 0.0)                                                               \
+      return 1.0;                                                              \
+                                                                               \
+    type r = nondet_func();                                                    \
+    __ESBMC_assume(r >= -1.0 && r <= 1.0);                                     \
+    /* cos is positive on (-pi/2, pi/2) */                                     \
+    if(fabs_func(x) < (type)ABSTRACT_PI_2)                                     \
+      __ESBMC_assume(r > 0.0);                                                 \
+    return r;                                                                  \
+  }
+
+cos_abstract_def(float, cosf_abstract, fabsf, nondet_float);
+cos_abstract_def(double, cos_abstract, fabs, nondet_double);
+cos_abstract_def(long double, cosl_abstract, fabsl, nondet_ldouble);
+
+#define tan_abstract_def(type, name, fabs_func, nondet_func)                   \
+  type name(type x)                                                            \
+  {                                                                            \
+  __ESBMC_HIDE:;                                                               \
+    if(isnan(x) || isinf(x))                                                   \
+      return NAN;                                                              \
+                                                                               \
+    /* tan(+-0) = +-0 */                                                       \
+    if(x == 0.0)                                                               \
+      return x;                                                                \
+                                                                               \
+    type r = nondet_func();                                                    \
+    __ESBMC_assume(!isnan(r));                                                 \
+    /* |tan(x)| >= |x| on (-pi/2, pi/2), with the sign of x */                 \
+    if(fabs_func(x) < (type)ABSTRACT_PI_2)                                     \
+      __ESBMC_assume(x > 0.0 ? r >= x : r <= x);                               \
+    return r;                                                                  \
+  }
+
+tan_abstract_def(float, tanf_abstract, fabsf, nondet_float);
+tan_abstract_def(double, tan_abstract, fabs, nondet_double);
+tan_abstract_def(long double, tanl_abstract, fabsl, nondet_ldouble);
+
+#define atan_abstract_def(type, name, fabs_func, nondet_func)                  \
+  type name(type x)                                                            \
+  {                                                                            \
+  __ESBMC_HIDE:;                                                               \
+    if(isnan(x))                                                               \
+      return x;                                                                \
+                                                                               \
+    type r = nondet_func();                                                    \
+    __ESBMC_assume(                                                            \
+      r >= -(type)ABSTRACT_PI_2 && r <= (type)ABSTRACT_PI_2);                  \
+    /* |atan(x)| <= |x|, with the sign of x */                                 \
+    __ESBMC_assume(fabs_func(r) <= fabs_func(x));                              \
+    __ESBMC_assume(!signbit(r) == !signbit(x));                                \
+    abstract_monotone(type, x, r, 1);                                          \
+    return r;                                                                  \
+  }
+
+atan_abstract_def(float, atanf_abstract, fabsf, nondet_float);
+atan_abstract_def(double, atan_abstract, fabs, nondet_double);
+atan_abstract_def(long double, atanl_abstract, fabsl, nondet_ldouble);
+
+#define acos_abstract_def(type, name, nondet_func)                             \
+  type name(type x)                                                            \
+  {                                                                            \
+  __ESBMC_HIDE:;                                                               \
+    if(isnan(x) || x < -1.0 || x > 1.0)                                        \
+      return NAN;                                                              \
+                                                                               \
+    if(x == 1.0)                                                               \
+      return 0.0;                                                              \
+                                                                               \
+    type r = nondet_func();                                                    \
+    __ESBMC_assume(r >= 0.0 && r <= (type)ABSTRACT_PI);                        \
+    /* acos is above pi/2 exactly for negative arguments */                    \
+    if(x < 0.0)                                                                \
+      __ESBMC_assume(r >= (type)ABSTRACT_PI_2);                                \
+    else                                                                       \
+      __ESBMC_assume(r <= (type)ABSTRACT_PI_2);                                \
+    abstract_monotone(type, x, r, -1);                                         \
+    return r;                                                                  \
+  }
+
+acos_abstract_def(float, acosf_abstract, nondet_float);
+acos_abstract_def(double, acos_abstract, nondet_double);
+acos_abstract_def(long double, acosl_abstract, nondet_ldouble);
+
+#define exp_abstract_def(type, name, nondet_func)                              \
+  type name(type x)                                                            \
+  {                                                                            \
+  __ESBMC_HIDE:;                                                               \
+    if(isnan(x))                                                               \
+      return x;                                                                \
+                                                                               \
+    if(isinf(x))                                                               \
+      return x > 0.0 ? x : 0.0;                                                \
+                                                                               \
+    if(x == 0.0)                                                               \
+      return 1.0;                                                              \
+                                                                               \
+    type r = nondet_func();                                                    \
+    __ESBMC_assume(r >= 0.0);                                                  \
+    __ESBMC_assume(x > 0.0 ? r >= 1.0 : r <= 1.0);                             \
+    /* exp is convex: exp(x) >= 1 + x */                                       \
+    __ESBMC_assume(r >= 1 + x);                                                \
+    abstract_monotone(type, x, r, 1);                                          \
+    return r;                                                                  \
+  }
+
+exp_abstract_def(float, expf_abstract, nondet_float);
+exp_abstract_def(double, exp_abstract, nondet_double);
+exp_abstract_def(long double, expl_abstract, nondet_ldouble);
+
+#define log_abstract_def(type, name, nondet_func)                              \
+  type name(type x)                                                            \
+  {                                                                            \
+  __ESBMC_HIDE:;                                                               \
+    if(isnan(x) || x < 0.0)                                                    \
+      return NAN;                                                              \
+                                                                               \
+    if(x == 0.0)                                                               \
+      return -INFINITY;                                                        \
+                                                                               \
+    if(isinf(x))                                                               \
+      return x;                                                                \
+                                                                               \
+    if(x == 1.0)                                                               \
+      return 0.0;                                                              \
+                                                                               \
+    type r = nondet_func();                                                    \
+    __ESBMC_assume(x > 1.0 ? r >= 0.0 : r <= 0.0);                             \
+    /* log is concave: log(x) <= x - 1 */                                      \
+    __ESBMC_assume(r <= x - 1);                                                \
+    abstract_monotone(type, x, r, 1);                                          \
+    return r;                                                                  \
+  }
+
+log_abstract_def(float, logf_abstract, nondet_float);
+log_abstract_def(double, log_abstract, nondet_double);
+log_abstract_def(long double, logl_abstract, nondet_ldouble);
+
+#define pow_abstract_def(type, name, nondet_func)                              \
+  type name(type x, type y)                                                    \
+  {                                                                            \
+  __ESBMC_HIDE:;                                                               \
+    if(y == 0.0 || x == 1.0)                                                   \
+      return 1.0;                                                              \
+                                                                               \
+    if(isnan(x) || isnan(y))                                                   \
+      return NAN;                                                              \
+                                                                               \
+    if(y == 1.0)                                                               \
+      return x;                                                                \
+                                                                               \
+    type r = nondet_func();                                                    \
+    if(x > 0.0)                                                                \
+    {                                                                          \
+      /* Positive bases stay on the same side of one for positive exponents */ \
+      __ESBMC_assume(r >= 0.0);                                                \
+      if(y > 0.0)                                                              \
+        __ESBMC_assume(x > 1.0 ? r >= 1.0 : r <= 1.0);                         \
+      else                                                                     \
+        __ESBMC_assume(x > 1.0 ? r <= 1.0 : r >= 1.0);                         \
+    }                                                                          \
+    return r;                                                                  \
+  }
+
+pow_abstract_def(float, powf_abstract, nondet_float);
+pow_abstract_def(double, pow_abstract, nondet_double);
+pow_abstract_def(long double, powl_abstract, nondet_ldouble);
+
+/* The remainder is exact, so beyond the special cases it is bounded by both
+ * operands and has the sign of the dividend. */
+#define fmod_abstract_def(type, name, fabs_func, nondet_func)                  \
+  type name(type x, type y)                                                    \
+  {                                                                            \
+  __ESBMC_HIDE:;                                                               \
+    if(isnan(x) || isnan(y) || isinf(x) || y == 0.0)                           \
+      return NAN;                                                              \
+                                                                               \
+    if(x == 0.0 || isinf(y) || fabs_func(x) < fabs_func(y))                    \
+      return x;                                                                \
+                                                                               \
+    type r = nondet_func();                                                    \
+    __ESBMC_assume(fabs_func(r) < fabs_func(y));                               \
+    __ESBMC_assume(fabs_func(r) <= fabs_func(x));                              \
+    __ESBMC_assume(!signbit(r) == !signbit(x));                                \
+    return r;                                                                  \
+  }
+
+fmod_abstract_def(float, fmodf_abstract, fabsf, nondet_float);
+fmod_abstract_def(double, fmod_abstract, fabs, nondet_double);
+fmod_abstract_def(long double, fmodl_abstract, fabsl, nondet_ldouble);
+
+#undef fmod_abstract_def
+#undef pow_abstract_def
+#undef log_abstract_def
+#undef exp_abstract_def
+#undef acos_abstract_def
+#undef atan_abstract_def
+#undef tan_abstract_def
+#undef cos_abstract_def
+#undef sin_abstract_def
+#undef abstract_monotone
@@ -57,6 +57,9 @@ pthread_t __ESBMC_get_thread_id(void);
 void __ESBMC_really_atomic_begin(void);
 void __ESBMC_really_atomic_end(void);
 
+void __ESBMC_mutex_lock(int *lock);
+void __ESBMC_mutex_unlock(int *lock);
+
 /************************** Linked List Implementation **************************/
 
 typedef struct thread_key
@@ -71,6 +74,7 @@ static __ESBMC_thread_key *head = NULL;
 
 int insert_key_value(pthread_key_t key, const void *value)
 {
+__ESBMC_HIDE:;
   __ESBMC_thread_key *l =
     (__ESBMC_thread_key *)malloc(sizeof(__ESBMC_thread_key));
   if(l == NULL)
@@ -311,29 +315,23 @@ int pthread_mutex_initializer(pthread_mutex_t *mutex)
 int pthread_mutex_lock_noassert(pthread_mutex_t *mutex)
 {
 __ESBMC_HIDE:;
-  __ESBMC_atomic_begin();
-  pthread_mutex_initializer(mutex);
-  __ESBMC_assume(!__ESBMC_mutex_lock_field(*mutex));
-  __ESBMC_mutex_lock_field(*mutex) = 1;
-  __ESBMC_atomic_end();
+  // Waiting for the lock and taking it is a single step of symex
+  __ESBMC_mutex_lock(&__ESBMC_mutex_lock_field(*mutex));
   return 0;
 }
 
 int pthread_mutex_lock_nocheck(pthread_mutex_t *mutex)
 {
 __ESBMC_HIDE:;
-  __ESBMC_atomic_begin();
-  pthread_mutex_initializer(mutex);
-  __ESBMC_assume(!__ESBMC_mutex_lock_field(*mutex));
-  __ESBMC_mutex_lock_field(*mutex) = 1;
-  __ESBMC_atomic_end();
+  // Waiting for the lock and taking it is a single step of symex
+  __ESBMC_mutex_lock(&__ESBMC_mutex_lock_field(*mutex));
   return 0;
 }
 
 int pthread_mutex_unlock_noassert(pthread_mutex_t *mutex)
 {
 __ESBMC_HIDE:;
-  __ESBMC_mutex_lock_field(*mutex) = 0;
+  __ESBMC_mutex_unlock(&__ESBMC_mutex_lock_field(*mutex));
   return 0;
 }
 
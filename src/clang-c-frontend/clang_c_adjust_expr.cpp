@@ -153,6 +153,10 @@ void clang_c_adjust::adjust_symbol(exprt &expr)
   if(s == nullptr)
     return;
 
+  // Typed by the frontend after the function whose contract uses it
+  if(identifier == "c:@__ESBMC_return_value")
+    return;
+
   // found it
   const symbolt &symbol = *s;
 
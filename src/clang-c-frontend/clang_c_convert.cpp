@@ -2142,8 +2142,14 @@ bool clang_c_convertert::get_decl_ref(const clang::Decl &d, exprt &new_expr)
     std::string name, id;
     get_decl_name(*nd, name, id);
 
+    // The value returned by a function, in its contract, has the return
+    // type of that function rather than the type it is declared with
+    clang::QualType q_type = nd->getType();
+    if(id == "c:@__ESBMC_return_value" && current_functionDecl)
+      q_type = current_functionDecl->getReturnType();
+
     typet type;
-    if(get_type(nd->getType(), type))
+    if(get_type(q_type, type))
       return true;
 
     new_expr = exprt("symbol", type);
@@ -2184,6 +2190,13 @@ bool clang_c_convertert::get_cast_expr(
   case clang::CK_UncheckedDerivedToBase:
     break;
 
+  case clang::CK_LValueToRValue:
+    // Clang typed the contract return value as declared, so reading it must
+    // not convert it
+    if(expr.identifier() != "c:@__ESBMC_return_value")
+      gen_typecast(ns, expr, type);
+    break;
+
   case clang::CK_DerivedToBase:
   case clang::CK_Dynamic:
 
@@ -2203,7 +2216,6 @@ bool clang_c_convertert::get_cast_expr(
 
   case clang::CK_ToVoid:
   case clang::CK_BitCast:
-  case clang::CK_LValueToRValue:
   case clang::CK_LValueBitCast:
 
   case clang::CK_PointerToBoolean:
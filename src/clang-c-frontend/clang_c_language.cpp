@@ -97,6 +97,16 @@ void clang_c_languaget::build_compiler_args(const std::string &tmp_dir)
     compiler_args.emplace_back("-Dpthread_cond_wait=pthread_cond_wait_nocheck");
   }
 
+  if(config.options.get_bool_option("abstract-libm"))
+  {
+    // Swap the precise libm models for the ones in libm/abstract.c
+    for(const char *f :
+        {"sin", "cos", "tan", "atan", "acos", "exp", "log", "pow", "fmod"})
+      for(const char *suffix : {"", "f", "l"})
+        compiler_args.push_back(
+          fmt::format("-D{0}{1}={0}{1}_abstract", f, suffix));
+  }
+
   for(auto const &def : config.ansi_c.defines)
     compiler_args.push_back("-D" + def);
 
@@ -317,6 +327,13 @@ unsigned __ESBMC_alloc_size[1];
 // Get object size
 unsigned __ESBMC_get_object_size(const void *);
 
+// Function contracts
+void __ESBMC_requires(_Bool);
+void __ESBMC_ensures(_Bool);
+void __ESBMC_assigns(const void *, ...);
+// Retyped to the return type of the function whose contract uses it
+int __ESBMC_return_value;
+
 
 _Bool __ESBMC_is_little_endian();
 
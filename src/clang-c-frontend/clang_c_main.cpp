@@ -1,4 +1,5 @@
 #include <cassert>
+#include <map>
 #include <util/arith_tools.h>
 #include <util/c_types.h>
 #include <util/config.h>
@@ -8,9 +9,51 @@
 #include <util/std_code.h>
 #include <util/std_expr.h>
 
+// Arrays at least this long are initialised sparsely, if at most
+// max_sparse_updates of their elements differ from the most common one.
+static const std::size_t min_sparse_array = 64;
+static const std::size_t max_sparse_updates = 64;
+
+/// Rewrite a large constant array literal, such as a mostly zero lookup table,
+/// into an array_of of its most common element with the remaining elements
+/// written over it. Symex propagates that as a constant without ever
+/// expanding it, and the solver gets a constant array and a few stores.
+static void compact_array_initializer(exprt &value)
+{
+  if(!value.is_constant() || !value.type().is_array())
+    return;
+
+  const exprt::operandst &elems = value.operands();
+  if(elems.size() < min_sparse_array || value.type().subtype().is_array())
+    return;
+
+  std::map<exprt, std::size_t> counts;
+  for(const exprt &e : elems)
+  {
+    if(!e.is_constant())
+      return;
+    counts[e]++;
+  }
+
+  auto common = counts.begin();
+  for(auto it = counts.begin(); it != counts.end(); it++)
+    if(it->second > common->second)
+      common = it;
+
+  if(elems.size() - common->second > max_sparse_updates)
+    return;
+
+  exprt res = array_of_exprt(common->first, value.type());
+  for(std::size_t i = 0; i < elems.size(); i++)
+    if(elems[i] != common->first)
+      res = with_exprt(res, from_integer(i, index_type()), elems[i]);
+
+  value.swap(res);
+}
+
 static inline void init_variable(codet &dest, const symbolt &sym)
 {
-  const exprt &value = sym.value;
+  exprt value = sym.value;
 
   if(value.is_nil())
     return;
@@ -20,7 +63,9 @@ static inline void init_variable(codet &dest, const symbolt &sym)
   exprt symbol("symbol", sym.type);
   symbol.identifier(sym.id);
 
-  code_assignt code(symbol, sym.value);
+  compact_array_initializer(value);
+
+  code_assignt code(symbol, value);
   code.location() = sym.location;
 
   dest.move_to_operands(code);
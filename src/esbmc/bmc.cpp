@@ -26,7 +26,9 @@ Authors: Daniel Kroening, kroening@kroening.com
 #include <fstream>
 #include <goto-programs/goto_loops.h>
 #include <goto-symex/build_goto_trace.h>
+#include <goto-symex/formula_features.h>
 #include <goto-symex/goto_trace.h>
+#include <goto-symex/int_encoding_check.h>
 #include <goto-symex/reachability_tree.h>
 #include <goto-symex/slice.h>
 #include <goto-symex/xml_goto_trace.h>
@@ -36,6 +38,7 @@ Authors: Daniel Kroening, kroening@kroening.com
 #include <sstream>
 #include <util/i2string.h>
 #include <irep2/irep2.h>
+#include <irep2/irep2_region.h>
 #include <util/location.h>
 #include <util/message/message_stream.h>
 #include <util/message/format.h>
@@ -87,6 +90,65 @@ void bmct::do_cbmc(
   eq->convert(*smt_conv.get());
 }
 
+bool bmct::select_encoding(std::shared_ptr<symex_target_equationt> &eq)
+{
+  std::string reason;
+  bool use_ir = can_use_int_encoding(*eq, reason);
+
+  if(!use_ir)
+    msg.status(
+      fmt::format("Keeping bit-vector encoding: formula contains {}", reason));
+  return use_ir;
+}
+
+std::shared_ptr<smt_convt>
+bmct::create_solver(std::shared_ptr<symex_target_equationt> &eq)
+{
+  std::string strategy_file = options.get_option("solver-strategy");
+  bool show_features = options.get_bool_option("show-formula-features");
+  bool ir_whole_formula = options.get_bool_option("ir-whole-formula") &&
+                          !options.get_bool_option("ir");
+  if(strategy_file.empty() && !show_features && !ir_whole_formula)
+    return std::shared_ptr<smt_convt>(
+      create_solver_factory("", ns, options, msg));
+
+  // The encoding is chosen for this query only
+  solver_options = options;
+  if(ir_whole_formula)
+    solver_options.set_option("int-encoding", select_encoding(eq));
+
+  formula_featurest features;
+  features.add(*eq);
+
+  if(show_features)
+  {
+    std::ostringstream oss;
+    features.output(oss);
+    msg.status(oss.str());
+  }
+
+  std::string solver_name;
+  if(!strategy_file.empty())
+  {
+    if(!strategy)
+    {
+      strategy = std::make_unique<solver_strategyt>();
+      strategy->load(strategy_file);
+    }
+
+    const solver_strategyt::rulet *rule = strategy->select(features);
+    if(rule)
+    {
+      msg.status(fmt::format(
+        "Using solver strategy from {}:{}", strategy_file, rule->line));
+      solver_strategyt::apply(*rule, solver_options, solver_name);
+    }
+  }
+
+  return std::shared_ptr<smt_convt>(
+    create_solver_factory(solver_name, ns, solver_options, msg));
+}
+
 void bmct::successful_trace()
 {
   if(options.get_bool_option("result-only"))
@@ -143,7 +205,7 @@ smt_convt::resultt bmct::run_decision_procedure(
 {
   std::string logic;
 
-  if(!options.get_bool_option("int-encoding"))
+  if(!smt_conv->int_encoding)
   {
     logic = "bit-vector";
     logic += (!config.ansi_c.use_fixed_for_float) ? "/floating-point " : " ";
@@ -372,17 +434,57 @@ smt_convt::resultt bmct::start_bmc()
 smt_convt::resultt bmct::run(std::shared_ptr<symex_target_equationt> &eq)
 {
   symex->options.set_option("unwind", options.get_option("unwind"));
-  symex->setup_for_new_explore();
 
   if(options.get_bool_option("schedule"))
+  {
+    symex->setup_for_new_explore();
     return run_thread(eq);
+  }
+
+  if(options.get_bool_option("iterative-context-bound"))
+    return run_preemption_bounded(eq);
+
+  symex->setup_for_new_explore();
+  return explore_interleavings(eq);
+}
+
+smt_convt::resultt
+bmct::run_preemption_bounded(std::shared_ptr<symex_target_equationt> &eq)
+{
+  // Most concurrency bugs need only one or two preemptions: check every
+  // interleaving with none, then those with one, and so on, instead of
+  // going deep into the DFS order first
+  smt_convt::resultt res = smt_convt::P_UNSATISFIABLE;
+  for(int bound = 0;; bound++)
+  {
+    symex->set_preemption_bound(bound, bound);
+    symex->setup_for_new_explore();
+
+    res = explore_interleavings(eq);
+    if(res == smt_convt::P_ERROR || res == smt_convt::P_SMTLIB)
+      return res;
+
+    if(res == smt_convt::P_SATISFIABLE && !options.get_bool_option("all-runs"))
+      return res;
+
+    msg.status_fmt(
+      "Explored every interleaving with at most {} preemption(s)", bound);
+
+    if(!symex->is_preemption_bound_hit())
+      break;
+  }
 
+  return interleaving_failed > 0 ? smt_convt::P_SATISFIABLE : res;
+}
+
+smt_convt::resultt
+bmct::explore_interleavings(std::shared_ptr<symex_target_equationt> &eq)
+{
   smt_convt::resultt res;
   do
   {
     if(++interleaving_number > 1)
-      msg.status(
-        fmt::format("*** Thread interleavings {} ***", interleaving_number));
+      msg.status_fmt("*** Thread interleavings {} ***", interleaving_number);
 
     fine_timet bmc_start = current_time();
     res = run_thread(eq);
@@ -536,8 +638,10 @@ void bmct::bidirectional_search(
     // and add it to the goto program
     goto_programt::targett loop_exit = lit->get_original_loop_exit();
 
+    // The constraints are built from SSA steps, which may live in the arena
+    // of the last run, but the goto program outlives it
     goto_programt::instructiont i;
-    i.make_assertion(not2tc(constraints));
+    i.make_assertion(irep2_regiont::copy_out(not2tc(constraints)));
     i.location = loop_exit->location;
     i.location.user_provided(true);
     i.loop_number = loop_exit->loop_number;
@@ -552,6 +656,33 @@ void bmct::bidirectional_search(
 }
 
 smt_convt::resultt bmct::run_thread(std::shared_ptr<symex_target_equationt> &eq)
+{
+  if(!options.get_bool_option("ssa-arena"))
+    return symex_and_solve(eq);
+
+  // Everything built for this run is allocated from one region
+  smt_convt::resultt res;
+  {
+    irep2_regiont region;
+    res = symex_and_solve(eq);
+  }
+
+  // Only a counterexample needs the equation and the solver past this point.
+  // Otherwise drop them here, with the region already closed so that their
+  // nodes aren't recycled one by one: once the last of them has gone, the
+  // region releases all of its memory at once.
+  if(res != smt_convt::P_SATISFIABLE && !options.get_bool_option("all-runs"))
+  {
+    eq.reset();
+    if(!options.get_bool_option("smt-during-symex"))
+      runtime_solver.reset();
+  }
+
+  return res;
+}
+
+smt_convt::resultt
+bmct::symex_and_solve(std::shared_ptr<symex_target_equationt> &eq)
 {
   std::shared_ptr<goto_symext::symex_resultt> result;
 
@@ -665,10 +796,7 @@ smt_convt::resultt bmct::run_thread(std::shared_ptr<symex_target_equationt> &eq)
     }
 
     if(!options.get_bool_option("smt-during-symex"))
-    {
-      runtime_solver =
-        std::shared_ptr<smt_convt>(create_solver_factory("", ns, options, msg));
-    }
+      runtime_solver = create_solver(eq);
 
     return run_decision_procedure(runtime_solver, eq);
   }
@@ -9,6 +9,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #ifndef CPROVER_CBMC_BMC_H
 #define CPROVER_CBMC_BMC_H
 
+#include <esbmc/solver_strategy.h>
 #include <goto-symex/reachability_tree.h>
 #include <goto-symex/symex_target_equation.h>
 #include <langapi/language_ui.h>
@@ -42,7 +43,19 @@ protected:
   namespacet ns;
   const messaget &msg;
   std::shared_ptr<smt_convt> runtime_solver;
+  // Options the runtime solver was created with, when --ir-whole-formula or
+  // a solver strategy overrides some of them for the current query
+  optionst solver_options;
+  std::unique_ptr<solver_strategyt> strategy;
   std::shared_ptr<reachability_treet> symex;
+  /** Check every interleaving the reachability tree was set up for. */
+  smt_convt::resultt
+  explore_interleavings(std::shared_ptr<symex_target_equationt> &eq);
+  /** Check interleavings in increasing order of their number of
+   *  preemptions, with --iterative-context-bound. */
+  smt_convt::resultt
+  run_preemption_bounded(std::shared_ptr<symex_target_equationt> &eq);
+
   virtual smt_convt::resultt run_decision_procedure(
     std::shared_ptr<smt_convt> &smt_conv,
     std::shared_ptr<symex_target_equationt> &eq);
@@ -51,6 +64,12 @@ protected:
     std::shared_ptr<smt_convt> &smt_conv,
     std::shared_ptr<symex_target_equationt> &eq);
 
+  /** Whether eq can be encoded with integer/real arithmetic */
+  bool select_encoding(std::shared_ptr<symex_target_equationt> &eq);
+
+  std::shared_ptr<smt_convt>
+  create_solver(std::shared_ptr<symex_target_equationt> &eq);
+
   virtual void show_program(std::shared_ptr<symex_target_equationt> &eq);
   virtual void report_success();
   virtual void report_failure();
@@ -77,6 +96,8 @@ protected:
     std::shared_ptr<symex_target_equationt> &eq);
 
   smt_convt::resultt run_thread(std::shared_ptr<symex_target_equationt> &eq);
+  smt_convt::resultt
+  symex_and_solve(std::shared_ptr<symex_target_equationt> &eq);
 };
 
 #endif
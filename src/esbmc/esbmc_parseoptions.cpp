@@ -35,14 +35,18 @@ extern "C"
 #include <fstream>
 #include <goto-programs/add_race_assertions.h>
 #include <goto-programs/goto_check.h>
+#include <goto-programs/goto_contracts.h>
 #include <goto-programs/goto_convert_functions.h>
 #include <goto-programs/goto_inline.h>
+#include <goto-programs/incremental_cache.h>
 #include <goto-programs/goto_k_induction.h>
+#include <goto-programs/goto_pass_manager.h>
 #include <goto-programs/interval_analysis.h>
 #include <goto-programs/loop_numbers.h>
 #include <goto-programs/read_goto_binary.h>
 #include <goto-programs/remove_skip.h>
 #include <goto-programs/remove_unreachable.h>
+#include <goto-programs/resolve_function_pointers.h>
 #include <goto-programs/set_claims.h>
 #include <goto-programs/show_claims.h>
 #include <goto-programs/loop_unroll.h>
@@ -420,12 +424,19 @@ int esbmc_parseoptionst::doit()
   if(cmdline.isset("file-output"))
   {
     FILE *f = fopen(cmdline.getval("file-output"), "w+");
+    // Verbose runs write a lot, don't go to the disk for every few lines
+    if(f != nullptr)
+      setvbuf(f, nullptr, _IOFBF, 1 << 16);
     out = f;
     err = f;
   }
 
-  std::shared_ptr<message_handlert> handler =
-    std::make_shared<fmt_message_handler>(out, err);
+  // The writer thread wouldn't exist in the forked children
+  std::shared_ptr<message_handlert> handler;
+  if(cmdline.isset("async-output") && !cmdline.isset("k-induction-parallel"))
+    handler = std::make_shared<async_fmt_message_handler>(out, err);
+  else
+    handler = std::make_shared<fmt_message_handler>(out, err);
   msg.add_message_handler(handler);
   //
   // Print a banner
@@ -497,12 +508,37 @@ int esbmc_parseoptionst::doit()
   if(opts.get_bool_option("skip-bmc"))
     return 0;
 
+  if(cmdline.isset("incremental-cache"))
+    return doit_incremental_cache(opts);
+
   // do actual BMC
   bmct bmc(goto_functions, opts, context, msg);
 
   return do_bmc(bmc);
 }
 
+int esbmc_parseoptionst::doit_incremental_cache(optionst &opts)
+{
+  const std::string filename = cmdline.getval("incremental-cache");
+  const namespacet ns(context);
+
+  incremental_cachet cache(goto_functions, ns, opts, msg);
+  cache.load(filename);
+
+  cache.reuse_verdicts(goto_functions);
+
+  bmct bmc(goto_functions, opts, context, msg);
+  int res = do_bmc(bmc);
+
+  if(res == smt_convt::P_UNSATISFIABLE)
+    cache.record_safe();
+
+  if(cache.save(filename))
+    return 1;
+
+  return res;
+}
+
 int esbmc_parseoptionst::doit_k_induction_parallel()
 {
 #ifdef _WIN32
@@ -1581,17 +1617,34 @@ bool esbmc_parseoptionst::process_goto_program(
     if(options.get_bool_option("initialize-nondet-variables"))
       mark_decl_as_non_det(context, goto_functions).run();
 
+    // Contracts are expanded before inlining, so that replaced calls are not
+    // inlined in the first place
+    goto_contracts(context, options, goto_functions, msg);
+
+    // Resolved calls through function pointers can be inlined like any other
+    if(cmdline.isset("resolve-function-pointers"))
+      resolve_function_pointers(goto_functions, ns, msg);
+
     // do partial inlining
     if(!cmdline.isset("no-inlining"))
     {
       if(cmdline.isset("full-inlining"))
         goto_inline(goto_functions, options, ns, msg);
+      else if(cmdline.isset("selective-inlining"))
+        goto_selective_inline(goto_functions, options, ns, msg);
       else
         goto_partial_inline(goto_functions, options, ns, msg);
     }
 
     if(cmdline.isset("interval-analysis"))
-      interval_analysis(goto_functions, ns);
+    {
+      unsigned int threads = 1;
+      if(
+        cmdline.isset("analysis-threads") &&
+        atoi(cmdline.getval("analysis-threads")) > 1)
+        threads = atoi(cmdline.getval("analysis-threads"));
+      interval_analysis(goto_functions, ns, threads);
+    }
 
     if(
       cmdline.isset("inductive-step") || cmdline.isset("k-induction") ||
@@ -1607,13 +1660,17 @@ bool esbmc_parseoptionst::process_goto_program(
 
     goto_check(ns, options, goto_functions, msg);
 
+    // Everything below goes through the pass manager, which only renumbers
+    // and reanalyses the functions a pass actually changed
+    goto_pass_managert passes(goto_functions, ns, msg);
+
     // show it?
     if(cmdline.isset("show-goto-value-sets"))
     {
-      value_set_analysist value_set_analysis(ns, msg);
-      value_set_analysis(goto_functions);
+      passes.update();
       std::ostringstream oss;
-      show_value_sets(goto_functions, value_set_analysis, oss);
+      show_value_sets(
+        goto_functions, passes.program_analysis<value_set_analysist>(), oss);
       msg.result(oss.str());
       return true;
     }
@@ -1631,32 +1688,33 @@ bool esbmc_parseoptionst::process_goto_program(
       goto_functions, ns, context, options, value_set_analysis);
 #endif
 
-    // remove skips
-    remove_skip(goto_functions);
-
-    // remove unreachable code
-    Forall_goto_functions(f_it, goto_functions)
-      remove_unreachable(f_it->second.body);
-
-    // remove skips
-    remove_skip(goto_functions);
-
-    // recalculate numbers, etc.
-    goto_functions.update();
-
-    // add loop ids
-    goto_functions.compute_loop_numbers();
+    // remove skips and unreachable code, and the skips that leaves behind
+    auto remove_skips = [](const irep_idt &, goto_functiont &f) {
+      goto_programt &body = f.body;
+      std::size_t size = body.instructions.size();
+      remove_skip(body, body.instructions.begin(), body.instructions.end());
+      return body.instructions.size() != size;
+    };
+    passes.run_on_functions(remove_skips);
+    passes.run_on_functions([](const irep_idt &, goto_functiont &f) {
+      return remove_unreachable(f.body);
+    });
+    passes.run_on_functions(remove_skips);
+
+    // recalculate numbers and loop ids
+    passes.update();
 
     if(cmdline.isset("data-races-check"))
     {
       msg.status("Adding Data Race Checks");
 
-      value_set_analysist value_set_analysis(ns, msg);
-      value_set_analysis(goto_functions);
-
-      add_race_assertions(value_set_analysis, context, goto_functions, msg);
-
-      value_set_analysis.update(goto_functions);
+      // The value sets are used while instrumenting, not afterwards
+      value_set_analysist &value_set_analysis =
+        passes.program_analysis<value_set_analysist>();
+      passes.run_on_program([&](goto_functionst &functions) {
+        add_race_assertions(value_set_analysis, context, functions, msg);
+      });
+      passes.update();
     }
 
     // show it?
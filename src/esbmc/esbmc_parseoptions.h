@@ -52,6 +52,7 @@ protected:
 
   int doit_falsification();
   int doit_incremental();
+  int doit_incremental_cache(optionst &opts);
   int doit_termination();
 
   int do_base_case(
@@ -77,6 +77,9 @@ const struct group_opt_templ all_cmd_options[] = {
     {"preprocess", NULL, "stop after preprocessing"},
     {"no-inlining", NULL, "disable inlining function calls"},
     {"full-inlining", NULL, "perform full inlining of function calls"},
+    {"selective-inlining",
+     NULL,
+     "inline function calls where a cost estimate says it pays off"},
     {"all-claims", NULL, "keep all claims"},
     {"show-loops", NULL, "show the loops in the program"},
     {"show-claims", NULL, "only show claims"},
@@ -84,6 +87,10 @@ const struct group_opt_templ all_cmd_options[] = {
     {"document-subgoals", NULL, "generate subgoals documentation"},
     {"no-arch", NULL, "don't set up an architecture"},
     {"no-library", NULL, "disable built-in abstract C library"},
+    {"abstract-libm",
+     NULL,
+     "model sin, cos, tan, atan, acos, exp, log, pow and fmod, in all their "
+     "precisions, by the range of their result instead of computing it"},
     {"binary", NULL, "read goto program instead of source code"},
     {"little-endian", NULL, "allow little-endian word-byte conversions"},
     {"big-endian", NULL, "allow big-endian word-byte conversions"},
@@ -97,6 +104,10 @@ const struct group_opt_templ all_cmd_options[] = {
     {"file-output",
      boost::program_options::value<std::string>(),
      "redirects every message into a file (no stdout/stderr)"},
+    {"async-output",
+     NULL,
+     "write messages from a background thread "
+     "(not with --k-induction-parallel)"},
     {"witness-output",
      boost::program_options::value<std::string>(),
      "generate the verification result witness in GraphML format"},
@@ -128,9 +139,20 @@ const struct group_opt_templ all_cmd_options[] = {
    {{"function",
      boost::program_options::value<std::string>()->value_name("name"),
      "set main function name"},
+    {"enforce-contract",
+     boost::program_options::value<std::string>()->value_name("name"),
+     "check function name against its contract, in isolation (implies "
+     "--function name)"},
+    {"replace-call-with-contract",
+     boost::program_options::value<std::string>()->value_name("f1,f2,..."),
+     "replace calls to the given functions (* for all) by their contracts"},
     {"claim",
      boost::program_options::value<std::vector<int>>()->value_name("nr"),
      "only check specific claim"},
+    {"incremental-cache",
+     boost::program_options::value<std::string>()->value_name("file"),
+     "keep the claims proven safe in file, and skip those whose code hasn't "
+     "changed on later runs"},
     {"instruction",
      boost::program_options::value<int>()->value_name("nr"),
      "limit the number of instructions executed during symbolic execution"},
@@ -153,6 +175,10 @@ const struct group_opt_templ all_cmd_options[] = {
      NULL,
      "do not unroll bounded loops at goto level"},
     {"slice-assumes", NULL, "remove unused assume statements"},
+    {"ssa-arena",
+     NULL,
+     "allocate the expressions of each symex run from one arena that is "
+     "released in bulk"},
     {"extended-try-analysis", NULL, ""},
     {"skip-bmc", NULL, ""}}},
   {"Incremental BMC",
@@ -171,6 +197,10 @@ const struct group_opt_templ all_cmd_options[] = {
     {"bitwuzla", NULL, "use Bitwuzla"},
     {"bv", NULL, "use solver with bit-vector arithmetic"},
     {"ir", NULL, "use solver with integer/real arithmetic"},
+    {"ir-whole-formula",
+     NULL,
+     "use integer/real arithmetic for the whole formula when it has no "
+     "bit-level operations and no arithmetic can wrap around"},
     {"smtlib", NULL, "use SMT lib format"},
     {"smtlib-solver-prog",
 
@@ -192,6 +222,16 @@ const struct group_opt_templ all_cmd_options[] = {
      NULL,
      "encode tuples using our tuple to symbol API"},
     {"array-flattener", NULL, "encode arrays using our array API"},
+    {"z3-tactic",
+     boost::program_options::value<std::string>()->value_name("t1,t2,..."),
+     "sequence of Z3 tactics to solve with"},
+    {"solver-strategy",
+     boost::program_options::value<std::string>()->value_name("<filename>"),
+     "pick solver and solver options per query from a table of rules on "
+     "formula features (\"builtin\" for the default table)"},
+    {"show-formula-features",
+     NULL,
+     "print the features of each formula before solving it"},
     {"no-return-value-opt",
      NULL,
      "disable return value optimization to compute the stack size"}}},
@@ -267,12 +307,21 @@ const struct group_opt_templ all_cmd_options[] = {
    {{"context-bound",
      boost::program_options::value<int>()->default_value(-1)->value_name("nr"),
      "limit number of context switches for each thread"},
+    {"iterative-context-bound",
+     NULL,
+     "explore interleavings in increasing order of their number of "
+     "preemptions"},
     {"state-hashing", NULL, "enable state-hashing, prunes duplicate states"},
     {"no-goto-merge",
      NULL,
      "do not not merge gotos when restoring the last paths after a "
      "context-switch"},
     {"no-por", NULL, "do not do partial order reduction"},
+    {"symmetry-reduction",
+     NULL,
+     "explore only one of the threads started from the same function with "
+     "the same argument that have yet to run; disabled when the program "
+     "observes thread IDs or uses thread handles"},
     {"all-runs",
      NULL,
      "check all interleavings, even if a bug was already found"}}},
@@ -289,10 +338,21 @@ const struct group_opt_templ all_cmd_options[] = {
      {"enable-core-dump", NULL, "do not disable core dump output"},
      {"no-simplify", NULL, "do not simplify any expression"},
      {"no-propagation", NULL, "disable constant propagation"},
+     {"per-object-alloc-state",
+      NULL,
+      "keep the validity and size of each dynamic object in its own "
+      "variables rather than in global tracking arrays"},
      {"interval-analysis",
       NULL,
       "enable interval analysis for integer variables and add assumes to the "
       "program"},
+     {"resolve-function-pointers",
+      NULL,
+      "replace calls through function pointers by direct calls where a "
+      "static points-to analysis narrows them to a few functions"},
+     {"analysis-threads",
+      boost::program_options::value<int>()->value_name("nr"),
+      "number of threads used by --interval-analysis (default is 1)"},
      {"add-symex-value-sets",
       NULL,
       "enable value-set analysis for pointers and add assumes to the "
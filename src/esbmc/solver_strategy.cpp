@@ -0,0 +1,204 @@
+/*******************************************************************\
+
+Module: Per-query solver strategy selection
+
+\*******************************************************************/
+
+#include <algorithm>
+#include <boost/algorithm/string.hpp>
+#include <cctype>
+#include <esbmc/solver_strategy.h>
+#include <fstream>
+#include <solvers/solve.h>
+#include <sstream>
+#include <util/mp_arith.h>
+
+// Used for --solver-strategy builtin. It only sets options every backend
+// understands, or that the others ignore, as it can't know which solvers
+// this build has.
+static const char *builtin_strategy =
+  "# Z3 does better on nonlinear arithmetic once it has been purified\n"
+  "nonlinear-mul > 0 : z3-tactic=simplify,purify-arith,solve-eqs,smt\n"
+  "# The solvers' own floating-point theories are mostly slower than\n"
+  "# ESBMC's bit-vector encoding of it\n"
+  "fp > 0            : fp2bv\n"
+  "default           :\n";
+
+// Options that change how a formula is solved, and so may be set per query,
+// with whether they take a value
+static const std::pair<const char *, bool> solver_settings[] = {
+  {"solver", true},
+  {"int-encoding", false},
+  {"fp2bv", false},
+  {"tuple-node-flattener", false},
+  {"tuple-sym-flattener", false},
+  {"array-flattener", false},
+  {"z3-tactic", true},
+  {"smtlib-solver-prog", true}};
+
+void solver_strategyt::load(const std::string &filename)
+{
+  if(filename == "builtin")
+  {
+    std::istringstream in(builtin_strategy);
+    parse(in, filename);
+    return;
+  }
+
+  std::ifstream in(filename);
+  if(!in)
+    throw "Failed to open solver strategy file " + filename;
+
+  parse(in, filename);
+}
+
+static void check_setting(
+  const std::string &where,
+  const std::string &name,
+  const std::string &value)
+{
+  auto it = std::find_if(
+    std::begin(solver_settings),
+    std::end(solver_settings),
+    [&name](const std::pair<const char *, bool> &s) {
+      return name == s.first;
+    });
+  if(it == std::end(solver_settings))
+    throw where + "unknown solver setting '" + name + "'";
+
+  if(it->second && value.empty())
+    throw where + "solver setting '" + name + "' needs a value";
+  if(!it->second && !value.empty())
+    throw where + "solver setting '" + name + "' takes no value";
+
+  if(name != "solver")
+    return;
+
+  for(unsigned int i = 0; i < esbmc_num_solvers; i++)
+    if(value == esbmc_solvers[i].name)
+      return;
+  throw where + "solver '" + value + "' is not built into this ESBMC";
+}
+
+void solver_strategyt::parse(std::istream &in, const std::string &filename)
+{
+  static const char *ops[] = {"<=", ">=", "==", "!=", "<", ">"};
+
+  std::string line;
+  unsigned line_no = 0;
+  while(std::getline(in, line))
+  {
+    line_no++;
+    line = line.substr(0, line.find('#'));
+    boost::trim(line);
+    if(line.empty())
+      continue;
+
+    std::string where = filename + ":" + std::to_string(line_no) + ": ";
+    std::size_t colon = line.find(':');
+    if(colon == std::string::npos)
+      throw where + "expected ':' between conditions and settings";
+
+    rulet rule;
+    rule.line = line_no;
+
+    std::string conds = boost::trim_copy(line.substr(0, colon));
+    if(conds != "default")
+    {
+      std::vector<std::string> parts;
+      boost::split(parts, conds, boost::is_any_of(","));
+      for(std::string &part : parts)
+      {
+        boost::trim(part);
+        conditiont c;
+        for(const char *op : ops)
+        {
+          std::size_t pos = part.find(op);
+          if(pos == std::string::npos)
+            continue;
+
+          c.feature = boost::trim_copy(part.substr(0, pos));
+          c.op = op;
+          std::string value =
+            boost::trim_copy(part.substr(pos + c.op.size()));
+          if(value.empty() || !std::all_of(value.begin(), value.end(), ::isdigit))
+            throw where + "expected a number in condition '" + part + "'";
+          c.value = string2integer(value);
+          break;
+        }
+
+        if(c.op.empty() || c.feature.empty())
+          throw where + "malformed condition '" + part + "'";
+        if(!formula_featurest::is_feature(c.feature))
+          throw where + "unknown formula feature '" + c.feature + "'";
+        rule.conditions.push_back(c);
+      }
+    }
+
+    std::istringstream settings(line.substr(colon + 1));
+    std::string setting;
+    while(settings >> setting)
+    {
+      std::size_t eq = setting.find('=');
+      if(eq == std::string::npos)
+        rule.settings.emplace_back(setting, "");
+      else
+        rule.settings.emplace_back(
+          setting.substr(0, eq), setting.substr(eq + 1));
+      check_setting(
+        where, rule.settings.back().first, rule.settings.back().second);
+    }
+
+    rules.push_back(rule);
+  }
+}
+
+bool solver_strategyt::holds(
+  const conditiont &c,
+  const formula_featurest &features)
+{
+  BigInt v = features.get(c.feature);
+  if(c.op == "<")
+    return v < c.value;
+  if(c.op == "<=")
+    return v <= c.value;
+  if(c.op == ">")
+    return v > c.value;
+  if(c.op == ">=")
+    return v >= c.value;
+  if(c.op == "==")
+    return v == c.value;
+  return v != c.value;
+}
+
+const solver_strategyt::rulet *
+solver_strategyt::select(const formula_featurest &features) const
+{
+  for(const rulet &rule : rules)
+  {
+    bool match = std::all_of(
+      rule.conditions.begin(),
+      rule.conditions.end(),
+      [&features](const conditiont &c) { return holds(c, features); });
+    if(match)
+      return &rule;
+  }
+
+  return nullptr;
+}
+
+void solver_strategyt::apply(
+  const rulet &rule,
+  optionst &options,
+  std::string &solver)
+{
+  for(const auto &setting : rule.settings)
+  {
+    if(setting.first == "solver")
+      solver = setting.second;
+    else if(setting.second.empty())
+      options.set_option(setting.first, true);
+    else
+      options.set_option(setting.first, setting.second);
+  }
+}
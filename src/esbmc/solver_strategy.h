@@ -0,0 +1,66 @@
+/*******************************************************************\
+
+Module: Per-query solver strategy selection
+
+\*******************************************************************/
+
+#ifndef CPROVER_ESBMC_SOLVER_STRATEGY_H
+#define CPROVER_ESBMC_SOLVER_STRATEGY_H
+
+#include <goto-symex/formula_features.h>
+#include <util/options.h>
+#include <vector>
+
+/// A table of rules mapping formula features to solver settings. Each
+/// non-empty line of a strategy file that is not a comment (#) reads
+///
+///   <feature> <op> <number>, ... : <option>[=<value>] ...
+///
+/// where <op> is one of < <= > >= == != and the conditions are conjoined.
+/// "default" matches every formula. The first matching rule wins; its
+/// settings are applied as options before the solver is created, and the
+/// special setting "solver=<name>" picks the backend, e.g.
+///
+///   nonlinear-mul > 0 : solver=z3 z3-tactic=simplify,purify-arith,smt
+///   fp > 0            : solver=z3 fp2bv
+///   default           : solver=boolector
+///
+/// Features must be known to formula_featurest, and settings must be
+/// options that affect the solver; anything else is a parse error. The file
+/// name "builtin" stands for a table that comes with ESBMC.
+class solver_strategyt
+{
+public:
+  struct conditiont
+  {
+    std::string feature;
+    std::string op;
+    BigInt value;
+  };
+
+  struct rulet
+  {
+    unsigned line;
+    std::vector<conditiont> conditions;
+    std::vector<std::pair<std::string, std::string>> settings;
+  };
+
+  /// Throws a std::string describing the problem on malformed input
+  void load(const std::string &filename);
+  void parse(std::istream &in, const std::string &filename);
+
+  /// Return the first rule matching the features, or nullptr if none does
+  const rulet *select(const formula_featurest &features) const;
+
+  /// Apply a rule's settings to the options, returning the chosen solver
+  /// name, if any, in solver
+  static void
+  apply(const rulet &rule, optionst &options, std::string &solver);
+
+  std::vector<rulet> rules;
+
+protected:
+  static bool holds(const conditiont &c, const formula_featurest &features);
+};
+
+#endif
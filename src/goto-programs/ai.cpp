@@ -11,10 +11,16 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include "ai.h"
 
+#include <atomic>
 #include <cassert>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <sstream>
+#include <thread>
 
+#include <goto-programs/call_graph.h>
+#include <util/irep_sharing.h>
 #include <util/std_code.h>
 #include <util/std_expr.h>
 
@@ -285,3 +291,293 @@ void ai_baset::sequential_fixedpoint(
   if(f_it != goto_functions.function_map.end())
     fixedpoint(f_it->second.body, goto_functions, ns);
 }
+
+struct ai_baset::scc_workt
+{
+  /// Index of the component in the call graph
+  unsigned int scc;
+  const call_grapht *call_graph;
+  /// Call sites of every function, with the function they are in
+  const std::map<
+    irep_idt,
+    std::vector<std::pair<irep_idt, goto_programt::const_targett>>>
+    *call_sites;
+  /// Exit states of all functions as of the start of the round
+  const std::map<irep_idt, std::unique_ptr<statet>> *exits;
+
+  /// Locations still to be visited, by function
+  std::map<irep_idt, working_sett> working;
+
+  /// Edges into functions of other components, merged after the round
+  struct call_edget
+  {
+    irep_idt callee;
+    goto_programt::const_targett from;
+    goto_programt::const_targett to;
+    std::unique_ptr<statet> state;
+  };
+  std::vector<call_edget> calls;
+
+  /// Functions of this component whose exit state grew during the round
+  std::set<irep_idt> grown;
+};
+
+void ai_baset::put_in_working_set(
+  scc_workt &work,
+  const irep_idt &function,
+  goto_programt::const_targett l)
+{
+  put_in_working_set(work.working[function], l);
+}
+
+void ai_baset::visit_scc(
+  const irep_idt &function,
+  goto_programt::const_targett l,
+  scc_workt &work,
+  const goto_functionst &goto_functions,
+  const namespacet &ns)
+{
+  const goto_programt &goto_program =
+    goto_functions.function_map.at(function).body;
+
+  statet &current = get_state(l);
+
+  goto_programt::const_targetst successors;
+  goto_program.get_successors(l, successors);
+
+  for(const auto &to_l : successors)
+  {
+    if(to_l == goto_program.instructions.end())
+      continue;
+
+    if(!l->is_function_call())
+    {
+      std::unique_ptr<statet> tmp_state(make_temporary_state(current));
+      tmp_state->transform(l, to_l, *this, ns);
+
+      if(!merge(*tmp_state, l, to_l))
+        continue;
+
+      put_in_working_set(work, function, to_l);
+
+      if(to_l->is_end_function())
+      {
+        // Return sites within the component see the new exit state right
+        // away, the others after the round
+        work.grown.insert(function);
+        auto sites = work.call_sites->find(function);
+        if(sites != work.call_sites->end())
+          for(const auto &site : sites->second)
+            if(work.call_graph->scc_of(site.first) == work.scc)
+              put_in_working_set(work, site.first, site.second);
+      }
+      continue;
+    }
+
+    // As in do_function_call_rec, function pointers must have been removed
+    const expr2tc &function_expr = to_code_function_call2t(l->code).function;
+    if(!is_symbol2t(function_expr))
+      continue;
+
+    const irep_idt &callee = to_symbol2t(function_expr).thename;
+    goto_functionst::function_mapt::const_iterator f_it =
+      goto_functions.function_map.find(callee);
+    assert(f_it != goto_functions.function_map.end());
+
+    const goto_functiont &goto_function = f_it->second;
+    if(!goto_function.body_available)
+    {
+      std::unique_ptr<statet> tmp_state(make_temporary_state(current));
+      tmp_state->transform(l, to_l, *this, ns);
+
+      if(merge(*tmp_state, l, to_l))
+        put_in_working_set(work, function, to_l);
+      continue;
+    }
+
+    assert(!goto_function.body.instructions.empty());
+    goto_programt::const_targett l_begin =
+      goto_function.body.instructions.begin();
+    goto_programt::const_targett l_end =
+      --goto_function.body.instructions.end();
+    assert(l_end->is_end_function());
+
+    std::unique_ptr<statet> call_state(make_temporary_state(current));
+    call_state->transform(l, l_begin, *this, ns);
+
+    const statet *end_state;
+    if(work.call_graph->scc_of(callee) == work.scc)
+    {
+      if(merge(*call_state, l, l_begin))
+        put_in_working_set(work, callee, l_begin);
+      end_state = &get_state(l_end);
+    }
+    else
+    {
+      work.calls.push_back({callee, l, l_begin, std::move(call_state)});
+      end_state = work.exits->at(callee).get();
+    }
+
+    if(end_state->is_bottom())
+      continue; // function exit point not reachable (yet)
+
+    std::unique_ptr<statet> tmp_state(make_temporary_state(*end_state));
+    tmp_state->transform(l_end, to_l, *this, ns);
+
+    if(merge(*tmp_state, l_end, to_l))
+      put_in_working_set(work, function, to_l);
+  }
+}
+
+void ai_baset::fixedpoint_scc(
+  scc_workt &work,
+  const goto_functionst &goto_functions,
+  const namespacet &ns)
+{
+  while(!work.working.empty())
+  {
+    auto it = work.working.begin();
+    const irep_idt function = it->first;
+    goto_programt::const_targett l = get_next(it->second);
+    if(it->second.empty())
+      work.working.erase(it);
+
+    visit_scc(function, l, work, goto_functions, ns);
+  }
+}
+
+void ai_baset::scc_fixedpoint(
+  const goto_functionst &goto_functions,
+  const namespacet &ns,
+  unsigned int threads)
+{
+  goto_functionst::function_mapt::const_iterator main_it =
+    goto_functions.function_map.find(goto_functions.main_id());
+  if(main_it == goto_functions.function_map.end())
+    return;
+
+  call_grapht call_graph(goto_functions);
+
+  std::map<
+    irep_idt,
+    std::vector<std::pair<irep_idt, goto_programt::const_targett>>>
+    call_sites;
+  std::map<irep_idt, std::unique_ptr<statet>> exits;
+  forall_goto_functions(f_it, goto_functions)
+  {
+    const goto_programt &body = f_it->second.body;
+    if(!f_it->second.body_available || body.instructions.empty())
+      continue;
+
+    exits[f_it->first] =
+      make_temporary_state(get_state(--body.instructions.end()));
+
+    forall_goto_program_instructions(i_it, body)
+    {
+      if(!i_it->is_function_call())
+        continue;
+
+      const expr2tc &function = to_code_function_call2t(i_it->code).function;
+      if(is_symbol2t(function))
+        call_sites[to_symbol2t(function).thename].emplace_back(
+          f_it->first, i_it);
+    }
+  }
+
+  std::vector<scc_workt> work(call_graph.sccs.size());
+  for(unsigned int i = 0; i < work.size(); i++)
+  {
+    work[i].scc = i;
+    work[i].call_graph = &call_graph;
+    work[i].call_sites = &call_sites;
+    work[i].exits = &exits;
+  }
+
+  if(!main_it->second.body.empty())
+    put_in_working_set(
+      work[call_graph.scc_of(main_it->first)],
+      main_it->first,
+      main_it->second.body.instructions.begin());
+
+  for(;;)
+  {
+    // Components are ordered callees first, which is as good an order as
+    // any to run them in
+    std::vector<scc_workt *> ready;
+    for(auto &w : work)
+      if(!w.working.empty())
+        ready.push_back(&w);
+
+    if(ready.empty())
+      break;
+
+    // Components only touch the states of their own functions, so they can
+    // run concurrently
+    std::atomic<std::size_t> next(0);
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    auto worker = [&]() {
+      for(std::size_t i = next++; i < ready.size(); i = next++)
+      {
+        try
+        {
+          fixedpoint_scc(*ready[i], goto_functions, ns);
+        }
+        catch(...)
+        {
+          std::lock_guard<std::mutex> lock(error_mutex);
+          if(!error)
+            error = std::current_exception();
+        }
+      }
+    };
+
+    std::size_t num_threads = std::min<std::size_t>(threads, ready.size());
+    if(num_threads > 1)
+    {
+      // The workers share the goto program's expressions, and the types and
+      // names in them, until they have all been joined
+      irep_sharing_scopet sharing;
+      std::vector<std::thread> pool;
+      for(std::size_t i = 1; i < num_threads; i++)
+        pool.emplace_back(worker);
+      worker();
+      for(auto &t : pool)
+        t.join();
+    }
+    else
+      worker();
+
+    if(error)
+      std::rethrow_exception(error);
+
+    for(scc_workt *w : ready)
+    {
+      for(auto &call : w->calls)
+        if(merge(*call.state, call.from, call.to))
+          put_in_working_set(
+            work[call_graph.scc_of(call.callee)], call.callee, call.to);
+      w->calls.clear();
+
+      for(const irep_idt &function : w->grown)
+      {
+        const goto_programt &body =
+          goto_functions.function_map.at(function).body;
+        exits[function] =
+          make_temporary_state(get_state(--body.instructions.end()));
+
+        auto sites = call_sites.find(function);
+        if(sites == call_sites.end())
+          continue;
+
+        for(const auto &site : sites->second)
+        {
+          unsigned int scc = call_graph.scc_of(site.first);
+          if(scc != w->scc)
+            put_in_working_set(work[scc], site.first, site.second);
+        }
+      }
+      w->grown.clear();
+    }
+  }
+}
@@ -134,6 +134,40 @@ protected:
     const goto_functionst &goto_functions,
     const namespacet &ns);
 
+  /// Interprocedural fixedpoint driven by the strongly connected components
+  /// (SCCs) of the call graph. It proceeds in rounds. In each round, every
+  /// SCC with pending work is brought to a local fixedpoint, up to `threads`
+  /// of them at a time. Within an SCC, calls are followed as usual. A call
+  /// into another SCC uses the exit state the callee had at the start of the
+  /// round as its summary, and its entry state is only propagated after the
+  /// round. So a callee is analysed once per round with the join of all its
+  /// call sites, rather than once per call site. Callers are revisited when
+  /// the exit state of a callee grows. For a monotone domain this reaches
+  /// the same fixedpoint as sequential_fixedpoint.
+  void scc_fixedpoint(
+    const goto_functionst &goto_functions,
+    const namespacet &ns,
+    unsigned int threads);
+
+  struct scc_workt;
+
+  void put_in_working_set(
+    scc_workt &work,
+    const irep_idt &function,
+    goto_programt::const_targett l);
+
+  void fixedpoint_scc(
+    scc_workt &work,
+    const goto_functionst &goto_functions,
+    const namespacet &ns);
+
+  void visit_scc(
+    const irep_idt &function,
+    goto_programt::const_targett l,
+    scc_workt &work,
+    const goto_functionst &goto_functions,
+    const namespacet &ns);
+
   // Visit performs one step of abstract interpretation from location l
   // Depending on the instruction type it may compute a number of "edges"
   // or applications of the abstract transformer
@@ -237,6 +271,12 @@ protected:
   // this one creates states, if need be
   virtual statet &get_state(goto_programt::const_targett l) override
   {
+    // Only insert when needed, so that scc_fixedpoint can look states up
+    // from several threads once they have all been initialized
+    typename state_mapt::iterator it = state_map.find(l);
+    if(it != state_map.end())
+      return it->second;
+
     return state_map[l]; // calls default constructor
   }
 
@@ -290,4 +330,24 @@ private:
   }
 };
 
+/// ait computing its fixedpoint with ai_baset::scc_fixedpoint
+template <typename domainT>
+class scc_ait : public ait<domainT>
+{
+public:
+  explicit scc_ait(unsigned int _threads = 1)
+    : ait<domainT>(), threads(_threads)
+  {
+  }
+
+protected:
+  unsigned int threads;
+
+  void fixedpoint(const goto_functionst &goto_functions, const namespacet &ns)
+    override
+  {
+    this->scc_fixedpoint(goto_functions, ns, threads);
+  }
+};
+
 #endif // CPROVER_ANALYSES_AI_H
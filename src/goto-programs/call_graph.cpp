@@ -0,0 +1,130 @@
+/*******************************************************************\
+
+Module: Call Graph
+
+\*******************************************************************/
+
+#include <goto-programs/call_graph.h>
+
+call_grapht::call_grapht(const goto_functionst &goto_functions)
+{
+  for(const auto &it : goto_functions.function_map)
+  {
+    // Every function is a node, called or not
+    callees[it.first];
+    callers[it.first];
+  }
+
+  for(const auto &it : goto_functions.function_map)
+  {
+    if(!it.second.body_available)
+      continue;
+
+    for(const auto &instr : it.second.body.instructions)
+    {
+      if(!instr.is_function_call())
+        continue;
+
+      const code_function_call2t &call = to_code_function_call2t(instr.code);
+      if(!is_symbol2t(call.function))
+        continue;
+
+      const irep_idt &callee = to_symbol2t(call.function).thename;
+      if(goto_functions.function_map.count(callee) == 0)
+        continue;
+
+      callees[it.first][callee]++;
+      callers[callee].insert(it.first);
+    }
+  }
+
+  compute_sccs();
+}
+
+void call_grapht::compute_sccs()
+{
+  // Tarjan's algorithm, with an explicit stack as call chains can be long.
+  // Components are completed callees first, which is the order we want.
+  struct framet
+  {
+    irep_idt function;
+    std::map<irep_idt, unsigned int>::const_iterator next;
+  };
+
+  std::map<irep_idt, unsigned int> index, lowlink;
+  std::set<irep_idt> on_stack;
+  std::vector<irep_idt> stack;
+  unsigned int counter = 0;
+
+  for(const auto &root : callees)
+  {
+    if(index.count(root.first))
+      continue;
+
+    std::vector<framet> frames;
+    auto visit = [&](const irep_idt &f) {
+      index[f] = lowlink[f] = counter++;
+      stack.push_back(f);
+      on_stack.insert(f);
+      frames.push_back({f, callees.at(f).begin()});
+    };
+    visit(root.first);
+
+    while(!frames.empty())
+    {
+      framet &frame = frames.back();
+      const irep_idt f = frame.function;
+
+      if(frame.next != callees.at(f).end())
+      {
+        const irep_idt &g = (frame.next++)->first;
+        if(!index.count(g))
+          visit(g);
+        else if(on_stack.count(g))
+          lowlink[f] = std::min(lowlink[f], index[g]);
+        continue;
+      }
+
+      frames.pop_back();
+      if(!frames.empty())
+      {
+        const irep_idt &caller = frames.back().function;
+        lowlink[caller] = std::min(lowlink[caller], lowlink[f]);
+      }
+
+      if(lowlink[f] != index[f])
+        continue;
+
+      scct scc;
+      irep_idt g;
+      do
+      {
+        g = stack.back();
+        stack.pop_back();
+        on_stack.erase(g);
+        scc_index[g] = sccs.size();
+        scc.push_back(g);
+      } while(g != f);
+      sccs.push_back(std::move(scc));
+    }
+  }
+}
+
+unsigned int call_grapht::scc_of(const irep_idt &function) const
+{
+  return scc_index.at(function);
+}
+
+bool call_grapht::is_recursive(const irep_idt &function) const
+{
+  return sccs[scc_of(function)].size() > 1 ||
+         callees.at(function).count(function) != 0;
+}
+
+unsigned int call_grapht::num_call_sites(const irep_idt &function) const
+{
+  unsigned int n = 0;
+  for(const auto &caller : callers.at(function))
+    n += callees.at(caller).at(function);
+  return n;
+}
@@ -0,0 +1,47 @@
+/*******************************************************************\
+
+Module: Call Graph
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_PROGRAMS_CALL_GRAPH_H
+#define CPROVER_GOTO_PROGRAMS_CALL_GRAPH_H
+
+#include <goto-programs/goto_functions.h>
+#include <map>
+#include <set>
+#include <vector>
+
+/// Direct calls between the functions of a goto program. Calls through
+/// function pointers are not resolved and don't appear in the graph.
+class call_grapht
+{
+public:
+  explicit call_grapht(const goto_functionst &goto_functions);
+
+  typedef std::vector<irep_idt> scct;
+
+  /// Functions called by each function, with their number of call sites
+  std::map<irep_idt, std::map<irep_idt, unsigned int>> callees;
+  /// Functions calling each function
+  std::map<irep_idt, std::set<irep_idt>> callers;
+  /// Strongly connected components, every one after all the components it
+  /// calls into. Contains every function of the program.
+  std::vector<scct> sccs;
+
+  /// Index in sccs of the component of a function
+  unsigned int scc_of(const irep_idt &function) const;
+
+  /// Whether a function may end up calling itself
+  bool is_recursive(const irep_idt &function) const;
+
+  /// Number of call sites of a function in the whole program
+  unsigned int num_call_sites(const irep_idt &function) const;
+
+protected:
+  std::map<irep_idt, unsigned int> scc_index;
+
+  void compute_sccs();
+};
+
+#endif
@@ -0,0 +1,487 @@
+/*******************************************************************\
+
+Module: Function contracts
+
+\*******************************************************************/
+
+#include <algorithm>
+#include <goto-programs/goto_contracts.h>
+#include <irep2/irep2_utils.h>
+#include <util/i2string.h>
+#include <util/migrate.h>
+
+static const irep_idt requires_id = "c:@F@__ESBMC_requires";
+static const irep_idt ensures_id = "c:@F@__ESBMC_ensures";
+static const irep_idt assigns_id = "c:@F@__ESBMC_assigns";
+static const irep_idt return_value_id = "c:@__ESBMC_return_value";
+
+goto_contractst::goto_contractst(
+  contextt &_context,
+  const optionst &_options,
+  goto_functionst &_goto_functions,
+  const messaget &_msg)
+  : context(_context),
+    options(_options),
+    goto_functions(_goto_functions),
+    msg(_msg),
+    num_tmps(0)
+{
+}
+
+bool goto_contractst::collect(const irep_idt &id, goto_functiont &f)
+{
+  contractt c;
+  bool found = false;
+
+  for(auto &instr : f.body.instructions)
+  {
+    if(!instr.is_function_call())
+      continue;
+
+    const code_function_call2t &call = to_code_function_call2t(instr.code);
+    if(!is_symbol2t(call.function))
+      continue;
+
+    const irep_idt &name = to_symbol2t(call.function).thename;
+    if(name == requires_id)
+      c.pre.push_back(call.operands.at(0));
+    else if(name == ensures_id)
+      c.post.push_back(call.operands.at(0));
+    else if(name == assigns_id)
+      c.assigns.insert(
+        c.assigns.end(), call.operands.begin(), call.operands.end());
+    else
+      continue;
+
+    found = true;
+    instr.make_skip();
+  }
+
+  if(!found)
+    return false;
+
+  for(const auto &arg : f.type.arguments())
+    c.params.push_back(arg.get_identifier());
+  c.return_type = migrate_type(f.type.return_type());
+
+  contracts.emplace(id, std::move(c));
+  return true;
+}
+
+expr2tc goto_contractst::new_tmp(
+  const irep_idt &function,
+  const type2tc &type,
+  goto_programt &decl,
+  goto_programt &dead)
+{
+  symbolt new_symbol;
+  new_symbol.name = "contract$" + i2string(num_tmps++);
+  new_symbol.id = id2string(function) + "::$tmp::" + id2string(new_symbol.name);
+  new_symbol.module = function;
+  new_symbol.type = migrate_type_back(type);
+  new_symbol.lvalue = true;
+
+  symbolt *symbol_ptr;
+  context.move(new_symbol, symbol_ptr);
+
+  goto_programt::targett t = decl.add_instruction(DECL);
+  t->code = code_decl2tc(type, symbol_ptr->id);
+  t = dead.add_instruction(DEAD);
+  t->code = code_dead2tc(type, symbol_ptr->id);
+  return symbol2tc(type, symbol_ptr->id);
+}
+
+bool goto_contractst::name_matches(
+  const irep_idt &id,
+  const std::string &names) const
+{
+  if(names == "*")
+    return true;
+
+  const symbolt *s = context.find_symbol(id);
+  if(s == nullptr)
+    return false;
+
+  std::string name = id2string(s->name);
+  std::string::size_type start = 0;
+  while(start <= names.size())
+  {
+    std::string::size_type end = names.find(',', start);
+    if(end == std::string::npos)
+      end = names.size();
+    if(names.compare(start, end - start, name) == 0)
+      return true;
+    start = end + 1;
+  }
+
+  return false;
+}
+
+void goto_contractst::replace_symbols(
+  expr2tc &expr,
+  const std::map<irep_idt, expr2tc> &values)
+{
+  if(is_nil_expr(expr))
+    return;
+
+  if(is_symbol2t(expr))
+  {
+    auto it = values.find(to_symbol2t(expr).thename);
+    if(it == values.end())
+      return;
+
+    expr = it->second;
+    return;
+  }
+
+  expr->Foreach_operand(
+    [&values](expr2tc &e) { replace_symbols(e, values); });
+}
+
+void goto_contractst::check_assigns(
+  const irep_idt &id,
+  goto_programt &body,
+  goto_programt::targett it,
+  const contractt &c,
+  const std::vector<expr2tc> &locals)
+{
+  expr2tc lhs;
+  if(it->is_assign())
+    lhs = to_code_assign2t(it->code).target;
+  else if(it->is_function_call())
+    lhs = to_code_function_call2t(it->code).ret;
+
+  while(!is_nil_expr(lhs) && (is_member2t(lhs) || is_index2t(lhs)))
+    lhs = is_member2t(lhs) ? to_member2t(lhs).source_value
+                           : to_index2t(lhs).source_value;
+
+  expr2tc ptr;
+  if(is_nil_expr(lhs))
+    return;
+  else if(is_dereference2t(lhs))
+    ptr = to_dereference2t(lhs).value;
+  else if(is_symbol2t(lhs))
+  {
+    const irep_idt &name = to_symbol2t(lhs).thename;
+    const symbolt *s = context.find_symbol(name);
+    if(
+      s == nullptr || !s->static_lifetime ||
+      id2string(name).find("__ESBMC_") != std::string::npos)
+      return;
+    ptr = address_of2tc(lhs->type, lhs);
+  }
+  else
+    return;
+
+  // Writes through pointers to the function's own frame are not part of
+  // its frame condition
+  expr2tc allowed = gen_false_expr();
+  auto allow = [&ptr, &allowed](const expr2tc &target) {
+    expr2tc same = same_object2tc(ptr, target);
+    allowed = is_false(allowed) ? same : or2tc(allowed, same);
+  };
+  std::for_each(c.assigns.begin(), c.assigns.end(), allow);
+  std::for_each(locals.begin(), locals.end(), allow);
+
+  goto_programt::instructiont a;
+  a.make_assertion(allowed);
+  a.location = it->location;
+  a.location.property("assigns");
+  a.location.comment(
+    "write outside the assigns clause of " +
+    id2string(context.find_symbol(id)->name));
+  a.function = id;
+
+  // The write may be a jump target, so the check takes over its place
+  body.insert_swap(it, a);
+}
+
+void goto_contractst::instrument(
+  const irep_idt &id,
+  goto_functiont &f,
+  bool enforce)
+{
+  const contractt &c = contracts.at(id);
+  goto_programt &body = f.body;
+  const std::string &name = id2string(context.find_symbol(id)->name);
+  const locationt begin_loc = body.instructions.front().location;
+  goto_programt::targett end = std::prev(body.instructions.end());
+  assert(end->is_end_function());
+
+  if(enforce)
+  {
+    // Parameters, locals and the temporaries of the function
+    std::vector<expr2tc> locals;
+    for(std::size_t i = 0; i < c.params.size(); i++)
+    {
+      const type2tc type = migrate_type(f.type.arguments()[i].type());
+      locals.push_back(address_of2tc(type, symbol2tc(type, c.params[i])));
+    }
+    for(const auto &instr : body.instructions)
+    {
+      if(!instr.is_decl())
+        continue;
+      const code_decl2t &decl = to_code_decl2t(instr.code);
+      locals.push_back(
+        address_of2tc(decl.type, symbol2tc(decl.type, decl.value)));
+    }
+
+    for(auto it = body.instructions.begin(); it != body.instructions.end();
+        it++)
+    {
+      if(!it->is_assign() && !it->is_function_call())
+        continue;
+      check_assigns(id, body, it, c, locals);
+      if(it->is_assert())
+        it++;
+    }
+  }
+
+  // Postconditions talk about the values the parameters had on entry, and
+  // about the value being returned
+  std::map<irep_idt, expr2tc> values;
+  goto_programt entry(msg);
+  goto_programt dead(msg);
+  if(!c.post.empty())
+  {
+    for(std::size_t i = 0; i < c.params.size(); i++)
+    {
+      const type2tc type = migrate_type(f.type.arguments()[i].type());
+      expr2tc tmp = new_tmp(id, type, entry, dead);
+      goto_programt::targett t = entry.add_instruction(ASSIGN);
+      t->code = code_assign2tc(tmp, symbol2tc(type, c.params[i]));
+      values[c.params[i]] = tmp;
+    }
+
+    if(!is_empty_type(c.return_type))
+    {
+      expr2tc ret = new_tmp(id, c.return_type, entry, dead);
+      values[return_value_id] = ret;
+
+      for(auto it = body.instructions.begin(); it != body.instructions.end();
+          it++)
+      {
+        if(!it->is_return())
+          continue;
+
+        const code_return2t &r = to_code_return2t(it->code);
+        if(is_nil_expr(r.operand))
+          continue;
+
+        goto_programt::instructiont a;
+        a.make_assignment();
+        a.code = code_assign2tc(ret, r.operand);
+        a.location = it->location;
+        a.function = id;
+        body.insert_swap(it, a);
+        it++;
+      }
+    }
+  }
+
+  for(const auto &pre : c.pre)
+  {
+    goto_programt::targett t = entry.add_instruction();
+    t->location = begin_loc;
+    if(enforce)
+      t->make_assumption(pre);
+    else
+    {
+      t->make_assertion(pre);
+      t->location.property("precondition");
+      t->location.comment("precondition of " + name);
+    }
+  }
+
+  goto_programt exit(msg);
+  for(const auto &post : c.post)
+  {
+    expr2tc cond = post;
+    replace_symbols(cond, values);
+    goto_programt::targett t = exit.add_instruction();
+    t->make_assertion(cond);
+    t->location = end->location;
+    t->location.property("postcondition");
+    t->location.comment("postcondition of " + name);
+  }
+  exit.destructive_append(dead);
+
+  for(auto &instr : entry.instructions)
+  {
+    if(instr.location.is_nil())
+      instr.location = begin_loc;
+    instr.function = id;
+  }
+  for(auto &instr : exit.instructions)
+  {
+    if(instr.location.is_nil())
+      instr.location = end->location;
+    instr.function = id;
+  }
+
+  // Jumps to the old first instruction, e.g. loops, must not repeat the
+  // entry code; returns must run into the exit code.
+  body.destructive_insert(body.instructions.begin(), entry);
+  body.insert_swap(end, exit);
+}
+
+void goto_contractst::replace_calls(
+  const irep_idt &caller,
+  goto_programt &body,
+  const std::set<irep_idt> &replaced)
+{
+  for(auto it = body.instructions.begin(); it != body.instructions.end(); it++)
+  {
+    if(!it->is_function_call())
+      continue;
+
+    const code_function_call2t call = to_code_function_call2t(it->code);
+    if(!is_symbol2t(call.function))
+      continue;
+
+    const irep_idt &callee = to_symbol2t(call.function).thename;
+    if(!replaced.count(callee))
+      continue;
+
+    const contractt &c = contracts.at(callee);
+    const std::string &name = id2string(context.find_symbol(callee)->name);
+    const code_typet &type = goto_functions.function_map.at(callee).type;
+    goto_programt tmp(msg);
+    goto_programt dead(msg);
+
+    // Evaluate the arguments once, before anything gets havocked
+    std::map<irep_idt, expr2tc> values;
+    for(std::size_t i = 0; i < c.params.size(); i++)
+    {
+      const type2tc param_type = migrate_type(type.arguments()[i].type());
+      expr2tc arg = i < call.operands.size() ? call.operands[i]
+                                             : gen_nondet(param_type);
+      if(arg->type != param_type)
+        arg = typecast2tc(param_type, arg);
+
+      expr2tc sym = new_tmp(caller, param_type, tmp, dead);
+      goto_programt::targett t = tmp.add_instruction(ASSIGN);
+      t->code = code_assign2tc(sym, arg);
+      values[c.params[i]] = sym;
+    }
+
+    for(const auto &pre : c.pre)
+    {
+      expr2tc cond = pre;
+      replace_symbols(cond, values);
+      goto_programt::targett t = tmp.add_instruction();
+      t->make_assertion(cond);
+      t->location = it->location;
+      t->location.property("precondition");
+      t->location.comment("precondition of " + name);
+    }
+
+    for(const auto &target : c.assigns)
+    {
+      expr2tc ptr = target;
+      replace_symbols(ptr, values);
+      while(is_typecast2t(ptr))
+        ptr = to_typecast2t(ptr).from;
+
+      if(
+        !is_pointer_type(ptr) ||
+        is_empty_type(to_pointer_type(ptr->type).subtype))
+      {
+        msg.warning(fmt::format(
+          "Ignoring untyped target in the assigns clause of {}", name));
+        continue;
+      }
+
+      const type2tc &subtype = to_pointer_type(ptr->type).subtype;
+      goto_programt::targett t = tmp.add_instruction(ASSIGN);
+      t->code = code_assign2tc(
+        dereference2tc(subtype, ptr), gen_nondet(subtype));
+    }
+
+    expr2tc ret;
+    if(!is_empty_type(c.return_type))
+    {
+      ret = new_tmp(caller, c.return_type, tmp, dead);
+      values[return_value_id] = ret;
+      goto_programt::targett t = tmp.add_instruction(ASSIGN);
+      t->code = code_assign2tc(ret, gen_nondet(c.return_type));
+    }
+
+    for(const auto &post : c.post)
+    {
+      expr2tc cond = post;
+      replace_symbols(cond, values);
+      goto_programt::targett t = tmp.add_instruction();
+      t->make_assumption(cond);
+    }
+
+    if(!is_nil_expr(call.ret) && !is_nil_expr(ret))
+    {
+      goto_programt::targett t = tmp.add_instruction(ASSIGN);
+      t->code = code_assign2tc(call.ret, ret);
+    }
+    tmp.destructive_append(dead);
+
+    for(auto &instr : tmp.instructions)
+    {
+      if(instr.location.is_nil())
+        instr.location = it->location;
+      instr.function = caller;
+    }
+
+    it->make_skip();
+    body.insert_swap(it, tmp);
+  }
+}
+
+void goto_contractst::run()
+{
+  Forall_goto_functions(it, goto_functions)
+    if(it->second.body_available)
+      collect(it->first, it->second);
+
+  const std::string enforce = options.get_option("enforce-contract");
+  const std::string replace = options.get_option("replace-call-with-contract");
+
+  if(!enforce.empty())
+  {
+    bool found = false;
+    for(const auto &c : contracts)
+      found |= name_matches(c.first, enforce);
+    if(!found)
+      msg.warning(fmt::format("Function {} has no contract", enforce));
+  }
+
+  if(contracts.empty())
+    return;
+
+  std::set<irep_idt> replaced;
+  if(!replace.empty())
+    for(const auto &c : contracts)
+      if(name_matches(c.first, replace))
+        replaced.insert(c.first);
+
+  Forall_goto_functions(it, goto_functions)
+    if(it->second.body_available && !replaced.empty())
+      replace_calls(it->first, it->second.body, replaced);
+
+  for(const auto &c : contracts)
+  {
+    bool enforced = !enforce.empty() && name_matches(c.first, enforce);
+    // Once every call is replaced the body only matters if it is checked
+    if(replaced.count(c.first) && !enforced)
+      continue;
+    instrument(c.first, goto_functions.function_map.at(c.first), enforced);
+  }
+
+  goto_functions.update();
+}
+
+void goto_contracts(
+  contextt &context,
+  const optionst &options,
+  goto_functionst &goto_functions,
+  const messaget &msg)
+{
+  goto_contractst(context, options, goto_functions, msg).run();
+}
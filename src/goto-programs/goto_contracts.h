@@ -0,0 +1,97 @@
+/*******************************************************************\
+
+Module: Function contracts
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_PROGRAMS_GOTO_CONTRACTS_H
+#define CPROVER_GOTO_PROGRAMS_GOTO_CONTRACTS_H
+
+#include <goto-programs/goto_functions.h>
+#include <util/context.h>
+#include <util/message/message.h>
+#include <util/options.h>
+
+/// Function contracts are written as calls at the start of a function body:
+///
+///   __ESBMC_requires(cond);   precondition over the parameters and globals
+///   __ESBMC_ensures(cond);    postcondition; __ESBMC_return_value names the
+///                             value being returned
+///   __ESBMC_assigns(p, ...);  the objects pointed to by p, ... are the only
+///                             non-local state the function may modify
+///
+/// The clauses are removed from the body and then, depending on the options:
+///
+///  - a function named by --enforce-contract is checked against its contract
+///    in isolation: it is the entry point, its precondition is assumed, its
+///    postcondition is asserted on return and every write to non-local state
+///    is asserted to hit an object from its assigns clause;
+///  - calls to functions named by --replace-call-with-contract ("*" for all
+///    functions with a contract) are replaced by an assertion of the
+///    precondition, a havoc of the assigns clause and of the return value,
+///    and an assumption of the postcondition;
+///  - any other function with a contract has its pre- and postcondition
+///    checked as assertions wherever it is called.
+class goto_contractst
+{
+public:
+  goto_contractst(
+    contextt &_context,
+    const optionst &_options,
+    goto_functionst &_goto_functions,
+    const messaget &_msg);
+
+  void run();
+
+protected:
+  struct contractt
+  {
+    std::vector<expr2tc> pre;
+    std::vector<expr2tc> post;
+    std::vector<expr2tc> assigns;
+    std::vector<irep_idt> params;
+    type2tc return_type;
+  };
+
+  contextt &context;
+  const optionst &options;
+  goto_functionst &goto_functions;
+  const messaget &msg;
+
+  std::map<irep_idt, contractt> contracts;
+  unsigned int num_tmps;
+
+  bool collect(const irep_idt &id, goto_functiont &f);
+  void instrument(const irep_idt &id, goto_functiont &f, bool enforce);
+  void check_assigns(
+    const irep_idt &id,
+    goto_programt &body,
+    goto_programt::targett it,
+    const contractt &c,
+    const std::vector<expr2tc> &locals);
+  void replace_calls(
+    const irep_idt &caller,
+    goto_programt &body,
+    const std::set<irep_idt> &replaced);
+
+  /// Local of function with the given type, to hold a value across the
+  /// instrumentation. Its DECL is appended to decl and its DEAD to dead.
+  expr2tc new_tmp(
+    const irep_idt &function,
+    const type2tc &type,
+    goto_programt &decl,
+    goto_programt &dead);
+  bool name_matches(const irep_idt &id, const std::string &names) const;
+
+  static void replace_symbols(
+    expr2tc &expr,
+    const std::map<irep_idt, expr2tc> &values);
+};
+
+void goto_contracts(
+  contextt &context,
+  const optionst &options,
+  goto_functionst &goto_functions,
+  const messaget &msg);
+
+#endif
@@ -7,6 +7,7 @@ Author: Daniel Kroening, kroening@kroening.com
 \*******************************************************************/
 
 #include <cassert>
+#include <goto-programs/call_graph.h>
 #include <goto-programs/goto_inline.h>
 #include <goto-programs/remove_skip.h>
 #include <langapi/language_util.h>
@@ -231,7 +232,9 @@ void goto_inlinet::expand_function_call(
   // see if we need to inline this
   if(!full)
   {
-    if(!f.body_available || (f.body.instructions.size() > smallfunc_limit))
+    if(
+      !f.body_available || (f.body.instructions.size() > smallfunc_limit &&
+                            selected.count(identifier) == 0))
     {
       target++;
       return;
@@ -557,3 +560,194 @@ void goto_partial_inline(
   if(goto_inline.get_error_found())
     throw 0;
 }
+
+/* Cost model for goto_selective_inline.
+ *
+ * Executing a call costs symex a new frame: declaring and assigning the
+ * parameters, level1 renaming of the locals, collecting the returns and
+ * merging the states at the end of the function. Inlining removes that, at
+ * the price of one copy of the callee per call site, each of which symex
+ * and the later passes then have to go through.
+ *
+ * The weight of a body estimates the latter: every instruction counts, more
+ * so if it dereferences a pointer, and more again for every loop around it.
+ * The benefit of inlining is the per-call overhead, counted once for every
+ * call site and again for every loop around that site. A function is inlined
+ * when it is tiny, or when the growth of the program, (sites - 1) * weight,
+ * doesn't exceed the benefit; single call sites are therefore always
+ * inlined, and large functions called from many places are left alone. */
+
+// Functions that weigh this little are always inlined
+static const unsigned int tiny_weight = 8;
+// Overhead of a call beyond its arguments and return value
+static const unsigned int call_overhead = 4;
+// Extra weight of an instruction dereferencing a pointer
+static const unsigned int deref_weight = 2;
+
+static bool has_dereference(const expr2tc &expr)
+{
+  if(is_nil_expr(expr))
+    return false;
+
+  if(is_dereference2t(expr))
+    return true;
+
+  bool res = false;
+  expr->foreach_operand(
+    [&res](const expr2tc &e) { res = res || has_dereference(e); });
+  return res;
+}
+
+// Number of loops around each instruction of a body, in order
+static std::vector<unsigned int> loop_depths(const goto_programt &body)
+{
+  std::map<goto_programt::const_targett, unsigned int> index;
+  unsigned int n = 0;
+  forall_goto_program_instructions(it, body)
+    index[it] = n++;
+
+  // Each backwards goto closes a loop: add one over its range
+  std::vector<int> delta(n + 1, 0);
+  n = 0;
+  forall_goto_program_instructions(it, body)
+  {
+    if(it->is_goto())
+    {
+      for(auto target : it->targets)
+      {
+        unsigned int head = index.at(target);
+        if(head <= n)
+        {
+          delta[head]++;
+          delta[n + 1]--;
+        }
+      }
+    }
+    n++;
+  }
+
+  std::vector<unsigned int> depths;
+  int depth = 0;
+  for(unsigned int i = 0; i + 1 < delta.size(); i++)
+  {
+    depth += delta[i];
+    depths.push_back(depth);
+  }
+  return depths;
+}
+
+static unsigned int call_cost(const goto_functiont &f)
+{
+  unsigned int cost = call_overhead + f.type.arguments().size();
+  if(f.type.return_type().id() != "empty")
+    cost++;
+  return cost;
+}
+
+void goto_selective_inline(
+  goto_functionst &goto_functions,
+  optionst &options,
+  const namespacet &ns,
+  const messaget &message_handler)
+{
+  // __ESBMC_main is left as it is, k-induction looks for the call to main
+  const irep_idt entry = "__ESBMC_main";
+  call_grapht call_graph(goto_functions);
+
+  // Loop depth of every call site of each function
+  std::map<irep_idt, std::vector<unsigned int>> sites;
+  // Weight of each body, on its own
+  std::map<irep_idt, unsigned int> weight;
+  for(const auto &it : goto_functions.function_map)
+  {
+    if(!it.second.body_available)
+      continue;
+
+    std::vector<unsigned int> depths = loop_depths(it.second.body);
+    unsigned int w = 0, i = 0;
+    forall_goto_program_instructions(instr, it.second.body)
+    {
+      unsigned int depth = depths[i++];
+      if(instr->is_skip() || instr->is_location() || instr->is_end_function())
+        continue;
+
+      unsigned int iw = 1;
+      if(has_dereference(instr->code) || has_dereference(instr->guard))
+        iw += deref_weight;
+      w += iw * (1 + depth);
+
+      if(instr->is_function_call() && it.first != entry)
+      {
+        const code_function_call2t &call =
+          to_code_function_call2t(instr->code);
+        if(is_symbol2t(call.function))
+          sites[to_symbol2t(call.function).thename].push_back(depth);
+      }
+    }
+    weight[it.first] = w;
+  }
+
+  goto_inlinet goto_inline(goto_functions, options, ns, message_handler);
+
+  // Callees come first, so that each body is weighed with whatever gets
+  // inlined into it already accounted for
+  for(const call_grapht::scct &scc : call_graph.sccs)
+  {
+    const irep_idt &id = scc.front();
+    if(scc.size() != 1 || call_graph.is_recursive(id) || !weight.count(id))
+      continue;
+
+    for(const auto &callee : call_graph.callees.at(id))
+      if(goto_inline.selected.count(callee.first))
+        weight[id] += callee.second * weight[callee.first];
+
+    auto s = sites.find(id);
+    if(s == sites.end())
+      continue;
+
+    const goto_functiont &f = goto_functions.function_map.find(id)->second;
+    unsigned int benefit = 0;
+    for(unsigned int depth : s->second)
+      benefit += call_cost(f) * (1 + depth);
+    unsigned int growth = weight[id] * (s->second.size() - 1);
+
+    if(weight[id] <= tiny_weight || growth <= benefit)
+      goto_inline.selected.insert(id);
+  }
+
+  message_handler.status_fmt(
+    "Selective inlining: inlining {} of {} functions",
+    goto_inline.selected.size(),
+    weight.size());
+
+  try
+  {
+    for(auto &it : goto_functions.function_map)
+    {
+      if(!it.second.body_available || it.first == entry)
+        continue;
+
+      goto_inline.inlined_funcs.clear();
+      goto_inline.goto_inline_rec(it.second.body, false);
+      it.second.inlined_funcs = goto_inline.inlined_funcs;
+    }
+  }
+
+  catch(int)
+  {
+    goto_inline.error();
+  }
+
+  catch(const char *e)
+  {
+    goto_inline.error(e);
+  }
+
+  catch(const std::string &e)
+  {
+    goto_inline.error(e);
+  }
+
+  if(goto_inline.get_error_found())
+    throw 0;
+}
@@ -37,6 +37,14 @@ void goto_partial_inline(
   const messaget &message_handler,
   unsigned _smallfunc_limit = 0);
 
+// inline the functions whose calls are estimated to cost symex more than
+// copying their bodies into the callers does, see goto_inline.cpp
+void goto_selective_inline(
+  goto_functionst &goto_functions,
+  optionst &options,
+  const namespacet &ns,
+  const messaget &message_handler);
+
 class goto_inlinet : public message_streamt
 {
 public:
@@ -66,6 +74,9 @@ public:
 
   unsigned smallfunc_limit;
 
+  // Functions to inline when not doing a full inlining, whatever their size
+  std::unordered_set<irep_idt, irep_id_hash> selected;
+
 protected:
   goto_functionst &goto_functions;
   optionst &options;
@@ -0,0 +1,137 @@
+/*******************************************************************\
+
+Module: Goto Pass Manager
+
+\*******************************************************************/
+
+#include <boost/functional/hash.hpp>
+#include <goto-programs/goto_pass_manager.h>
+
+goto_pass_managert::goto_pass_managert(
+  goto_functionst &_goto_functions,
+  const namespacet &_ns,
+  const messaget &_msg)
+  : goto_functions(_goto_functions), ns(_ns), msg(_msg)
+{
+  sync();
+}
+
+void goto_pass_managert::sync()
+{
+  for(auto it = state.begin(); it != state.end();)
+  {
+    if(goto_functions.function_map.count(it->first) == 0)
+    {
+      it = state.erase(it);
+      program_analyses.clear();
+    }
+    else
+      ++it;
+  }
+
+  // New functions are default constructed as changed
+  for(auto &it : goto_functions.function_map)
+    state[it.first];
+}
+
+void goto_pass_managert::invalidate(const irep_idt &function)
+{
+  function_statet &s = state[function];
+  s.changed = true;
+  s.analyses.clear();
+  program_analyses.clear();
+}
+
+void goto_pass_managert::invalidate_all()
+{
+  for(auto &it : state)
+  {
+    it.second.changed = true;
+    it.second.analyses.clear();
+  }
+  program_analyses.clear();
+}
+
+void goto_pass_managert::run_on_functions(const function_passt &pass)
+{
+  for(auto &it : goto_functions.function_map)
+    if(pass(it.first, it.second))
+      invalidate(it.first);
+}
+
+size_t goto_pass_managert::fingerprint(const goto_functiont &f)
+{
+  size_t seed = 0;
+  boost::hash_combine(seed, f.body_available);
+  boost::hash_combine(seed, f.body.instructions.size());
+
+  forall_goto_program_instructions(it, f.body)
+  {
+    // Instructions are compared by address, so that any that was replaced
+    // is noticed even if the new one looks the same
+    boost::hash_combine(seed, &*it);
+    boost::hash_combine(seed, static_cast<int>(it->type));
+    boost::hash_combine(seed, is_nil_expr(it->code) ? 0 : it->code.crc());
+    boost::hash_combine(seed, is_nil_expr(it->guard) ? 0 : it->guard.crc());
+    for(auto t : it->targets)
+      boost::hash_combine(seed, &*t);
+  }
+
+  return seed;
+}
+
+void goto_pass_managert::run_on_program(const program_passt &pass)
+{
+  std::map<irep_idt, size_t> before;
+  for(const auto &it : goto_functions.function_map)
+    before[it.first] = fingerprint(it.second);
+
+  pass(goto_functions);
+
+  sync();
+  for(const auto &it : goto_functions.function_map)
+  {
+    auto b = before.find(it.first);
+    if(b == before.end() || b->second != fingerprint(it.second))
+      invalidate(it.first);
+  }
+}
+
+void goto_pass_managert::update()
+{
+  sync();
+
+  // Same numbering as goto_functionst::update(): locations from 0 and loops
+  // from 1, counted across functions in map order. Functions that weren't
+  // changed keep their numbers unless those of an earlier one shifted them.
+  unsigned int location = 0;
+  unsigned int loop = 1;
+  for(auto &it : goto_functions.function_map)
+  {
+    function_statet &s = state.at(it.first);
+    goto_programt &body = it.second.body;
+
+    if(s.changed)
+      body.compute_target_numbers();
+
+    if(s.changed || s.first_location != location)
+    {
+      s.first_location = location;
+      body.compute_location_numbers(location);
+      s.num_locations = location - s.first_location;
+    }
+    else
+      location += s.num_locations;
+
+    if(s.changed || s.first_loop != loop)
+    {
+      s.first_loop = loop;
+      body.compute_loop_numbers(loop);
+      s.num_loops = loop - s.first_loop;
+    }
+    else
+      loop += s.num_loops;
+
+    s.changed = false;
+  }
+}
@@ -0,0 +1,116 @@
+/*******************************************************************\
+
+Module: Goto Pass Manager
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_PROGRAMS_GOTO_PASS_MANAGER_H
+#define CPROVER_GOTO_PROGRAMS_GOTO_PASS_MANAGER_H
+
+#include <functional>
+#include <goto-programs/goto_functions.h>
+#include <map>
+#include <memory>
+#include <typeindex>
+#include <util/message/message.h>
+#include <util/namespace.h>
+
+/// Runs passes over a goto program, keeping track of which functions each of
+/// them changed, so that whatever is derived from the functions is only
+/// recomputed for those that did:
+///
+///  - update() renumbers targets, locations and loops like
+///    goto_functionst::update(), with the same result, but only touches the
+///    functions that changed or whose numbers moved;
+///  - function_analysis<T>() caches an analysis of a single function until
+///    that function changes;
+///  - program_analysis<T>() caches an analysis of the whole program until
+///    any function changes.
+///
+/// Changes made behind the manager's back must be reported with
+/// invalidate(), or done within run_on_program().
+class goto_pass_managert
+{
+public:
+  goto_pass_managert(
+    goto_functionst &_goto_functions,
+    const namespacet &_ns,
+    const messaget &_msg);
+
+  /// Pass over one function at a time, returning whether it changed it
+  typedef std::function<bool(const irep_idt &, goto_functiont &)>
+    function_passt;
+
+  /// Pass over the whole program
+  typedef std::function<void(goto_functionst &)> program_passt;
+
+  void run_on_functions(const function_passt &pass);
+
+  /// The functions changed by the pass are found by comparing fingerprints
+  /// of all bodies before and after it
+  void run_on_program(const program_passt &pass);
+
+  void invalidate(const irep_idt &function);
+  void invalidate_all();
+
+  /// Bring target, location and loop numbers up to date
+  void update();
+
+  /// Analysis of one function, built as T(function, goto_functions,
+  /// goto_function, msg) the first time it's asked for since the function
+  /// last changed
+  template <typename T>
+  T &function_analysis(const irep_idt &function)
+  {
+    std::shared_ptr<void> &a = state[function].analyses[typeid(T)];
+    if(!a)
+      a = std::make_shared<T>(
+        function,
+        goto_functions,
+        goto_functions.function_map.at(function),
+        msg);
+    return *std::static_pointer_cast<T>(a);
+  }
+
+  /// Analysis of the whole program, built as T(ns, msg) and run over the
+  /// program the first time it's asked for since anything last changed
+  template <typename T>
+  T &program_analysis()
+  {
+    std::shared_ptr<void> &a = program_analyses[typeid(T)];
+    if(!a)
+    {
+      auto t = std::make_shared<T>(ns, msg);
+      (*t)(goto_functions);
+      a = t;
+    }
+    return *std::static_pointer_cast<T>(a);
+  }
+
+protected:
+  goto_functionst &goto_functions;
+  const namespacet &ns;
+  const messaget &msg;
+
+  struct function_statet
+  {
+    // Whether the numbers of this function are out of date
+    bool changed = true;
+    // First location and loop number given to this function, and how many
+    unsigned int first_location = 0;
+    unsigned int num_locations = 0;
+    unsigned int first_loop = 0;
+    unsigned int num_loops = 0;
+    std::map<std::type_index, std::shared_ptr<void>> analyses;
+  };
+
+  std::map<irep_idt, function_statet> state;
+  std::map<std::type_index, std::shared_ptr<void>> program_analyses;
+
+  /// Forget the state of functions that no longer exist
+  void sync();
+
+  static size_t fingerprint(const goto_functiont &f);
+};
+
+#endif
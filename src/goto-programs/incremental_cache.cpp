@@ -0,0 +1,287 @@
+/*******************************************************************\
+
+Module: Reuse of claim verdicts across program versions
+
+\*******************************************************************/
+
+#include <fstream>
+#include <goto-programs/call_graph.h>
+#include <goto-programs/incremental_cache.h>
+#include <langapi/language_util.h>
+#include <util/crypto_hash.h>
+#include <util/message/format.h>
+
+static void ingest(crypto_hash &h, const std::string &str)
+{
+  // Terminated, so that consecutive strings can't run into each other
+  h.ingest(str.c_str(), str.size() + 1);
+}
+
+incremental_cachet::incremental_cachet(
+  const goto_functionst &goto_functions,
+  const namespacet &_ns,
+  const optionst &options,
+  const messaget &_msg)
+  : ns(_ns), msg(_msg)
+{
+  // Every body, along with the globals it uses
+  std::map<irep_idt, std::string> bodies;
+  bool indirect = false;
+  forall_goto_functions(it, goto_functions)
+    bodies[it->first] = function_hash(it->first, it->second, indirect);
+
+  // Once functions are called through pointers or started as threads, which
+  // of them run before a claim is no longer a matter of direct calls: a
+  // thread's claims depend on whatever its spawner did before and on every
+  // other thread. Such programs are hashed as a whole.
+  std::set<std::string> whole_program;
+  if(indirect)
+    for(auto const &body : bodies)
+      whole_program.insert(id2string(body.first));
+
+  call_grapht graph(goto_functions);
+
+  forall_goto_functions(it, goto_functions)
+  {
+    const irep_idt &id = it->first;
+
+    std::set<std::string> cone = whole_program;
+    if(!indirect)
+    {
+      // Whatever may run before a claim of this function: its callers and
+      // everything they call
+      std::set<irep_idt> starts;
+      std::vector<irep_idt> work = {id};
+      while(!work.empty())
+      {
+        irep_idt f = work.back();
+        work.pop_back();
+        if(!starts.insert(f).second)
+          continue;
+
+        auto callers = graph.callers.find(f);
+        if(callers != graph.callers.end())
+          work.insert(
+            work.end(), callers->second.begin(), callers->second.end());
+      }
+
+      work.assign(starts.begin(), starts.end());
+      while(!work.empty())
+      {
+        irep_idt f = work.back();
+        work.pop_back();
+        if(!cone.insert(id2string(f)).second)
+          continue;
+
+        auto callees = graph.callees.find(f);
+        if(callees != graph.callees.end())
+          for(auto const &callee : callees->second)
+            work.push_back(callee.first);
+      }
+    }
+
+    unsigned int n = 0;
+    std::string hash;
+    forall_goto_program_instructions(i_it, it->second.body)
+    {
+      if(!i_it->is_assert())
+        continue;
+
+      if(hash.empty())
+      {
+        crypto_hash h;
+        for(auto const &opt : options.option_map)
+        {
+          if(opt.first == "incremental-cache")
+            continue;
+          ingest(h, opt.first);
+          ingest(h, opt.second);
+        }
+
+        for(auto const &f : cone)
+        {
+          ingest(h, f);
+          auto body = bodies.find(f);
+          ingest(h, body == bodies.end() ? "" : body->second);
+        }
+
+        h.fin();
+        hash = h.to_string();
+      }
+
+      hashes[claim_key(id, ++n, i_it->location.comment())] = hash;
+    }
+  }
+}
+
+std::string incremental_cachet::claim_key(
+  const irep_idt &function,
+  unsigned int n,
+  const irep_idt &comment)
+{
+  return id2string(function) + "\t" + std::to_string(n) + "\t" +
+         id2string(comment);
+}
+
+void incremental_cachet::collect_symbols(
+  const expr2tc &expr,
+  std::set<irep_idt> &symbols) const
+{
+  if(is_nil_expr(expr))
+    return;
+
+  if(is_symbol2t(expr))
+    symbols.insert(to_symbol2t(expr).thename);
+
+  expr->foreach_operand(
+    [this, &symbols](const expr2tc &e) { collect_symbols(e, symbols); });
+}
+
+std::string incremental_cachet::function_hash(
+  const irep_idt &id,
+  const goto_functiont &f,
+  bool &calls_pointers) const
+{
+  crypto_hash h;
+  if(!f.body_available)
+  {
+    ingest(h, "no body");
+    h.fin();
+    return h.to_string();
+  }
+
+  // Targets are hashed by their position, and locations not at all, so that
+  // moving code around in the source doesn't count as a change
+  std::map<const goto_programt::instructiont *, unsigned int> numbers;
+  unsigned int n = 0;
+  forall_goto_program_instructions(it, f.body)
+    numbers[&*it] = n++;
+
+  std::set<irep_idt> symbols;
+  forall_goto_program_instructions(it, f.body)
+  {
+    ingest(h, std::to_string((int)it->type));
+    ingest(h, from_expr(ns, id, it->guard, msg));
+    ingest(h, from_expr(ns, id, it->code, msg));
+    for(auto const &t : it->targets)
+      ingest(h, std::to_string(numbers[&*t]));
+
+    std::set<irep_idt> used;
+    if(it->is_function_call())
+    {
+      // The function called directly is an edge of the call graph; anything
+      // else naming a function takes its address
+      const code_function_call2t &call = to_code_function_call2t(it->code);
+      if(!is_symbol2t(call.function))
+        calls_pointers = true;
+
+      collect_symbols(call.ret, used);
+      for(auto const &arg : call.operands)
+        collect_symbols(arg, used);
+    }
+    else
+    {
+      collect_symbols(it->code, used);
+      collect_symbols(it->guard, used);
+    }
+
+    for(auto const &s : used)
+    {
+      const symbolt *sym;
+      if(ns.lookup(s, sym))
+        continue;
+
+      // A function whose address is taken may end up being called by
+      // whatever gets hold of it, a new thread for instance
+      if(sym->type.is_code())
+        calls_pointers = true;
+
+      symbols.insert(s);
+    }
+  }
+
+  // The globals used, with their types and initial values
+  for(auto const &s : symbols)
+  {
+    const symbolt &sym = ns.lookup(s);
+    if(!sym.static_lifetime || sym.type.is_code())
+      continue;
+
+    ingest(h, id2string(s));
+    ingest(h, from_type(ns, s, sym.type, msg));
+    ingest(h, sym.value.is_nil() ? "" : from_expr(ns, s, sym.value, msg));
+  }
+
+  h.fin();
+  return h.to_string();
+}
+
+void incremental_cachet::load(const std::string &filename)
+{
+  std::ifstream in(filename);
+  if(!in)
+    return;
+
+  // One safe claim per line: its hash, then its key
+  std::string line;
+  while(std::getline(in, line))
+  {
+    std::size_t sep = line.find(' ');
+    if(sep == std::string::npos)
+      continue;
+
+    stored[line.substr(sep + 1)] = line.substr(0, sep);
+  }
+}
+
+bool incremental_cachet::save(const std::string &filename) const
+{
+  std::ofstream out(filename);
+  if(!out)
+  {
+    msg.error(fmt::format("Failed to write cache file {}", filename));
+    return true;
+  }
+
+  for(auto const &claim : safe)
+    out << claim.second << " " << claim.first << "\n";
+
+  return false;
+}
+
+void incremental_cachet::reuse_verdicts(goto_functionst &goto_functions)
+{
+  unsigned int total = 0;
+  Forall_goto_functions(it, goto_functions)
+  {
+    unsigned int n = 0;
+    Forall_goto_program_instructions(i_it, it->second.body)
+    {
+      if(!i_it->is_assert())
+        continue;
+
+      total++;
+      std::string key = claim_key(it->first, ++n, i_it->location.comment());
+      auto s = stored.find(key);
+      if(s == stored.end() || s->second != hashes[key])
+        continue;
+
+      // Keep the property around as an assumption, which can only help the
+      // solver with whatever is left to check
+      reused.insert(key);
+      safe[key] = s->second;
+      i_it->make_assumption(i_it->guard);
+    }
+  }
+
+  msg.status(fmt::format(
+    "Reusing the verdicts of {} of {} claims from earlier runs",
+    reused.size(),
+    total));
+}
+
+void incremental_cachet::record_safe()
+{
+  for(auto const &claim : hashes)
+    safe[claim.first] = claim.second;
+}
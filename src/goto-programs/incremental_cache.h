@@ -0,0 +1,80 @@
+/*******************************************************************\
+
+Module: Reuse of claim verdicts across program versions
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_PROGRAMS_INCREMENTAL_CACHE_H
+#define CPROVER_GOTO_PROGRAMS_INCREMENTAL_CACHE_H
+
+#include <goto-programs/goto_functions.h>
+#include <map>
+#include <set>
+#include <string>
+#include <util/message/message.h>
+#include <util/namespace.h>
+#include <util/options.h>
+
+/// Claims proven safe by an earlier run stay safe as long as nothing they
+/// depend on has changed. What a claim depends on is approximated by the
+/// functions that may execute before it: its own function, every function
+/// that may (transitively) call it, and everything those may call. When any
+/// function calls through a pointer or takes the address of a function, as
+/// starting a thread does, every function may run before every claim, and
+/// the whole program is taken instead. A hash of the bodies of these
+/// functions, of the globals they use and of the options of the run is stored
+/// next to the verdict; claims whose hash is unchanged on the next run are
+/// assumed instead of being checked again.
+///
+/// Only safe verdicts are stored: a run that fails only shows one of the
+/// claims to be violated, and tells nothing about the other ones.
+class incremental_cachet
+{
+public:
+  /// Hashes the program as it is, so this has to be built before any claim
+  /// is removed from it.
+  incremental_cachet(
+    const goto_functionst &goto_functions,
+    const namespacet &ns,
+    const optionst &options,
+    const messaget &msg);
+
+  /// Read the verdicts of an earlier run; a missing file is an empty cache.
+  void load(const std::string &filename);
+  bool save(const std::string &filename) const;
+
+  /// Turn the claims whose stored verdict still holds into assumptions, and
+  /// report how many were reused. BMC still has to run: the checks symex
+  /// adds by itself (pointer safety, unwinding assertions, memory leaks...)
+  /// are not goto assertions, so none of them is cached.
+  void reuse_verdicts(goto_functionst &goto_functions);
+
+  /// Record that all the claims that were left to be checked hold.
+  void record_safe();
+
+protected:
+  const namespacet &ns;
+  const messaget &msg;
+
+  /// Hash of the dependencies of every claim of the program
+  std::map<std::string, std::string> hashes;
+  /// Claims removed by reuse_verdicts
+  std::set<std::string> reused;
+  /// Safe claims found in the cache, with the hash they were proven under
+  std::map<std::string, std::string> stored;
+  /// Safe claims to write back
+  std::map<std::string, std::string> safe;
+
+  /// Claims are identified by their function, their position among the
+  /// claims of that function and their description.
+  static std::string
+  claim_key(const irep_idt &function, unsigned int n, const irep_idt &comment);
+
+  std::string function_hash(
+    const irep_idt &id,
+    const goto_functiont &f,
+    bool &calls_pointers) const;
+  void collect_symbols(const expr2tc &expr, std::set<irep_idt> &symbols) const;
+};
+
+#endif
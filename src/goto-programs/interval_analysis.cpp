@@ -96,9 +96,12 @@ void instrument_intervals(
   }
 }
 
-void interval_analysis(goto_functionst &goto_functions, const namespacet &ns)
+void interval_analysis(
+  goto_functionst &goto_functions,
+  const namespacet &ns,
+  unsigned int threads)
 {
-  ait<interval_domaint> interval_analysis;
+  scc_ait<interval_domaint> interval_analysis(threads);
 
   interval_analysis(goto_functions, ns);
 
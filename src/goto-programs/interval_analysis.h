@@ -14,6 +14,11 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <goto-programs/goto_functions.h>
 
-void interval_analysis(goto_functionst &goto_functions, const namespacet &ns);
+/// Adds assumptions on the intervals of integer variables, as computed by an
+/// analysis running on up to `threads` threads
+void interval_analysis(
+  goto_functionst &goto_functions,
+  const namespacet &ns,
+  unsigned int threads = 1);
 
 #endif // CPROVER_ANALYSES_INTERVAL_ANALYSIS_H
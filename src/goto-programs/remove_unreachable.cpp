@@ -10,7 +10,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <set>
 #include <stack>
 
-void remove_unreachable(goto_programt &goto_program)
+bool remove_unreachable(goto_programt &goto_program)
 {
   std::set<goto_programt::targett> reachable;
   std::stack<goto_programt::targett> working;
@@ -40,9 +40,17 @@ void remove_unreachable(goto_programt &goto_program)
   // make all unreachable code a skip
   // unless it's an 'end_function'
 
+  bool changed = false;
   Forall_goto_program_instructions(it, goto_program)
   {
-    if(reachable.find(it) == reachable.end() && !it->is_end_function())
+    if(
+      reachable.find(it) == reachable.end() && !it->is_end_function() &&
+      !it->is_skip())
+    {
       it->make_skip();
+      changed = true;
+    }
   }
+
+  return changed;
 }
@@ -11,6 +11,7 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <goto-programs/goto_functions.h>
 
-void remove_unreachable(goto_programt &goto_program);
+/// Turns unreachable code into skips, returns whether there was any
+bool remove_unreachable(goto_programt &goto_program);
 
 #endif
@@ -0,0 +1,451 @@
+/*******************************************************************\
+
+Module: Static Resolution of Function Pointer Calls
+
+\*******************************************************************/
+
+#include <goto-programs/resolve_function_pointers.h>
+#include <irep2/irep2_utils.h>
+#include <pointer-analysis/value_set_analysis.h>
+#include <util/base_type.h>
+#include <util/migrate.h>
+
+// Beyond this, a dispatch is no cheaper than letting symex resolve the call
+static const unsigned int max_targets = 8;
+
+/// Functions whose address may be taken by expr, i.e. those that appear in it
+/// other than as the function being called
+static void
+get_address_taken(const expr2tc &expr, std::set<irep_idt> &address_taken)
+{
+  if(is_nil_expr(expr))
+    return;
+
+  if(is_symbol2t(expr) && is_code_type(expr))
+    address_taken.insert(to_symbol2t(expr).thename);
+
+  if(is_code_function_call2t(expr))
+  {
+    const code_function_call2t &call = to_code_function_call2t(expr);
+    if(!is_symbol2t(call.function))
+      get_address_taken(call.function, address_taken);
+    get_address_taken(call.ret, address_taken);
+    for(const auto &op : call.operands)
+      get_address_taken(op, address_taken);
+    return;
+  }
+
+  expr->foreach_operand([&address_taken](const expr2tc &e) {
+    get_address_taken(e, address_taken);
+  });
+}
+
+static bool is_compatible(
+  const type2tc &type,
+  const code_function_call2t &call,
+  const namespacet &ns)
+{
+  const code_type2t &code_type = to_code_type(type);
+  if(code_type.arguments.size() > call.operands.size())
+    return false;
+
+  if(code_type.arguments.size() < call.operands.size() && !code_type.ellipsis)
+    return false;
+
+  for(std::size_t i = 0; i < code_type.arguments.size(); i++)
+    if(!base_type_eq(code_type.arguments[i], call.operands[i]->type, ns))
+      return false;
+
+  return is_nil_expr(call.ret) ||
+         base_type_eq(code_type.ret_type, call.ret->type, ns);
+}
+
+/// Globals written by each function, and the direct calls between them.
+/// This is what tells whether the value sets at a call site can be trusted
+/// for a global function pointer.
+struct call_graph_infot
+{
+  std::map<irep_idt, std::set<irep_idt>> writes;
+  std::map<irep_idt, std::set<irep_idt>> callees;
+  std::map<irep_idt, std::set<irep_idt>> callers;
+
+  // Globals whose address is taken, and so may be written anywhere
+  std::set<irep_idt> escaped;
+
+  // Whether the program starts threads, which the value sets don't see
+  bool threads = false;
+};
+
+static void get_base_symbols(const expr2tc &expr, std::set<irep_idt> &symbols)
+{
+  if(is_nil_expr(expr))
+    return;
+
+  if(is_symbol2t(expr))
+  {
+    symbols.insert(to_symbol2t(expr).thename);
+    return;
+  }
+
+  // Only the object being written to, not the indices
+  if(is_index2t(expr))
+    get_base_symbols(to_index2t(expr).source_value, symbols);
+  else if(is_member2t(expr))
+    get_base_symbols(to_member2t(expr).source_value, symbols);
+  else if(is_typecast2t(expr))
+    get_base_symbols(to_typecast2t(expr).from, symbols);
+}
+
+static void get_escaped(const expr2tc &expr, std::set<irep_idt> &escaped)
+{
+  if(is_nil_expr(expr))
+    return;
+
+  if(is_address_of2t(expr))
+    get_base_symbols(to_address_of2t(expr).ptr_obj, escaped);
+
+  expr->foreach_operand(
+    [&escaped](const expr2tc &e) { get_escaped(e, escaped); });
+}
+
+static void
+get_call_graph_info(const goto_functionst &goto_functions, call_graph_infot &g)
+{
+  forall_goto_functions(f_it, goto_functions)
+    forall_goto_program_instructions(i_it, f_it->second.body)
+    {
+      get_escaped(i_it->code, g.escaped);
+      get_escaped(i_it->guard, g.escaped);
+
+      if(i_it->is_assign())
+        get_base_symbols(
+          to_code_assign2t(i_it->code).target, g.writes[f_it->first]);
+      else if(i_it->is_function_call())
+      {
+        const code_function_call2t &call =
+          to_code_function_call2t(i_it->code);
+        get_base_symbols(call.ret, g.writes[f_it->first]);
+        if(!is_symbol2t(call.function))
+          continue;
+
+        const irep_idt &callee = to_symbol2t(call.function).thename;
+        g.callees[f_it->first].insert(callee);
+        g.callers[callee].insert(f_it->first);
+        if(
+          callee == "c:@F@__ESBMC_spawn_thread" ||
+          callee == "c:@F@pthread_create")
+          g.threads = true;
+      }
+    }
+}
+
+static void transitive_closure(
+  const irep_idt &start,
+  const std::map<irep_idt, std::set<irep_idt>> &edges,
+  std::set<irep_idt> &reached)
+{
+  std::vector<irep_idt> work{start};
+  while(!work.empty())
+  {
+    irep_idt id = work.back();
+    work.pop_back();
+    if(!reached.insert(id).second)
+      continue;
+
+    auto e_it = edges.find(id);
+    if(e_it != edges.end())
+      work.insert(work.end(), e_it->second.begin(), e_it->second.end());
+  }
+}
+
+/// Whether the value sets may miss what the pointer called through in
+/// function points to. They follow the direct calls into and out of it,
+/// but neither other threads nor the functions called some other way.
+static bool may_be_written_elsewhere(
+  const expr2tc &ptr,
+  const irep_idt &function,
+  const call_graph_infot &g,
+  const namespacet &ns)
+{
+  if(g.threads)
+    return true;
+
+  std::set<irep_idt> symbols;
+  get_base_symbols(ptr, symbols);
+
+  std::set<irep_idt> related;
+  for(const irep_idt &s : symbols)
+  {
+    const symbolt *sym;
+    if(ns.lookup(s, sym) || !sym->static_lifetime)
+      continue;
+
+    if(g.escaped.count(s))
+      return true;
+
+    if(related.empty())
+    {
+      transitive_closure(function, g.callers, related);
+      related.erase(function);
+      transitive_closure(function, g.callees, related);
+    }
+
+    for(const auto &w : g.writes)
+      if(w.second.count(s) && !related.count(w.first))
+        return true;
+  }
+
+  return false;
+}
+
+/// Candidate functions of an indirect call, by name. Returns false if the
+/// call can't be resolved.
+static bool get_targets(
+  goto_programt::const_targett it,
+  const code_function_call2t &call,
+  value_setst &value_sets,
+  const goto_functionst &goto_functions,
+  const std::set<irep_idt> &address_taken,
+  const namespacet &ns,
+  std::map<irep_idt, expr2tc> &targets,
+  bool &keep_call)
+{
+  value_setst::valuest values;
+  value_sets.get_values(it, to_dereference2t(call.function).value, values);
+
+  bool unknown = false;
+  keep_call = false;
+  for(const auto &value : values)
+  {
+    if(is_unknown2t(value))
+    {
+      unknown = true;
+      continue;
+    }
+
+    if(!is_object_descriptor2t(value))
+    {
+      keep_call = true;
+      continue;
+    }
+
+    const object_descriptor2t &obj = to_object_descriptor2t(value);
+    if(
+      is_symbol2t(obj.object) && is_code_type(obj.object) &&
+      is_constant_int2t(obj.offset) &&
+      to_constant_int2t(obj.offset).value.is_zero())
+      targets.emplace(to_symbol2t(obj.object).thename, obj.object);
+    else
+      keep_call = true;
+  }
+
+  if(unknown)
+  {
+    // Anything the pointer could have been made to point to
+    keep_call = true;
+    for(const irep_idt &id : address_taken)
+    {
+      auto f_it = goto_functions.function_map.find(id);
+      if(f_it == goto_functions.function_map.end())
+        continue;
+
+      type2tc type = migrate_type(f_it->second.type);
+      if(is_compatible(type, call, ns))
+        targets.emplace(id, symbol2tc(type, id));
+    }
+  }
+
+  if(targets.empty() || targets.size() > max_targets)
+    return false;
+
+  // Symex skips calls to functions without a body when made through a
+  // pointer, but not direct ones
+  for(const auto &target : targets)
+  {
+    auto f_it = goto_functions.function_map.find(target.first);
+    if(
+      f_it == goto_functions.function_map.end() ||
+      !f_it->second.body_available)
+      return false;
+  }
+
+  return true;
+}
+
+static bool resolve_call(
+  const irep_idt &function,
+  goto_programt &goto_program,
+  goto_programt::targett it,
+  value_setst &value_sets,
+  const goto_functionst &goto_functions,
+  const std::set<irep_idt> &address_taken,
+  const call_graph_infot &call_graph_info,
+  const namespacet &ns)
+{
+  if(!is_true(it->guard))
+    return false;
+
+  const code_function_call2t call = to_code_function_call2t(it->code);
+  if(!is_dereference2t(call.function))
+    return false;
+
+  std::map<irep_idt, expr2tc> targets;
+  bool keep_call;
+  if(!get_targets(
+       it,
+       call,
+       value_sets,
+       goto_functions,
+       address_taken,
+       ns,
+       targets,
+       keep_call))
+    return false;
+
+  const expr2tc &ptr = to_dereference2t(call.function).value;
+  if(!keep_call)
+    keep_call =
+      may_be_written_elsewhere(ptr, function, call_graph_info, ns);
+
+  if(targets.size() == 1 && !keep_call)
+  {
+    it->code =
+      code_function_call2tc(call.ret, targets.begin()->second, call.operands);
+    return true;
+  }
+
+  goto_programt dispatch(goto_program.msg);
+
+  auto add_instruction = [&dispatch, &it](goto_program_instruction_typet type) {
+    goto_programt::targett t = dispatch.add_instruction(type);
+    t->location = it->location;
+    t->function = it->function;
+    return t;
+  };
+
+  // Each candidate is tested in turn, failed tests jump to the next one
+  goto_programt::targett failed = dispatch.instructions.end();
+  std::vector<goto_programt::targett> to_end;
+  std::size_t n = 0;
+  for(const auto &target : targets)
+  {
+    bool last = ++n == targets.size() && !keep_call;
+
+    goto_programt::targett test = dispatch.instructions.end();
+    if(!last)
+    {
+      expr2tc addr = address_of2tc(target.second->type, target.second);
+      if(addr->type != ptr->type)
+        addr = typecast2tc(ptr->type, addr);
+
+      test = add_instruction(GOTO);
+      test->guard = not2tc(equality2tc(ptr, addr));
+    }
+
+    goto_programt::targett t = add_instruction(FUNCTION_CALL);
+    t->code = code_function_call2tc(call.ret, target.second, call.operands);
+
+    if(failed != dispatch.instructions.end())
+      failed->targets.push_back(last ? t : test);
+    failed = test;
+
+    if(!last)
+      to_end.push_back(add_instruction(GOTO));
+  }
+
+  if(keep_call)
+  {
+    goto_programt::targett t = add_instruction(FUNCTION_CALL);
+    t->code = it->code;
+    failed->targets.push_back(t);
+  }
+
+  goto_programt::targett end = add_instruction(SKIP);
+  for(auto &g : to_end)
+    g->targets.push_back(end);
+
+  // The dispatch takes the place of the call, so that jumps to the call go
+  // to the dispatch instead
+  goto_programt::targett next = std::next(it);
+  dispatch.instructions.front().labels.swap(it->labels);
+  it->swap(dispatch.instructions.front());
+  dispatch.instructions.pop_front();
+  goto_program.destructive_insert(next, dispatch);
+
+  return true;
+}
+
+void resolve_function_pointers(
+  value_setst &value_sets,
+  goto_functionst &goto_functions,
+  const namespacet &ns,
+  const messaget &msg)
+{
+  std::set<irep_idt> address_taken;
+  forall_goto_functions(f_it, goto_functions)
+    forall_goto_program_instructions(i_it, f_it->second.body)
+    {
+      get_address_taken(i_it->code, address_taken);
+      get_address_taken(i_it->guard, address_taken);
+    }
+
+  call_graph_infot call_graph_info;
+  get_call_graph_info(goto_functions, call_graph_info);
+
+  // Collect the sites first, the dispatches contain indirect calls too
+  struct sitet
+  {
+    irep_idt function;
+    goto_programt *body;
+    goto_programt::targett it;
+  };
+  std::vector<sitet> sites;
+  Forall_goto_functions(f_it, goto_functions)
+    Forall_goto_program_instructions(i_it, f_it->second.body)
+      if(
+        i_it->is_function_call() &&
+        !is_symbol2t(to_code_function_call2t(i_it->code).function))
+        sites.push_back({f_it->first, &f_it->second.body, i_it});
+
+  unsigned int resolved = 0;
+  for(auto &site : sites)
+    if(resolve_call(
+         site.function,
+         *site.body,
+         site.it,
+         value_sets,
+         goto_functions,
+         address_taken,
+         call_graph_info,
+         ns))
+      resolved++;
+
+  msg.debug_fmt(
+    "Resolved {} of {} function pointer calls", resolved, sites.size());
+
+  goto_functions.update();
+}
+
+void resolve_function_pointers(
+  goto_functionst &goto_functions,
+  const namespacet &ns,
+  const messaget &msg)
+{
+  bool indirect_calls = false;
+  forall_goto_functions(f_it, goto_functions)
+    forall_goto_program_instructions(i_it, f_it->second.body)
+      if(
+        i_it->is_function_call() &&
+        !is_symbol2t(to_code_function_call2t(i_it->code).function))
+        indirect_calls = true;
+
+  if(!indirect_calls)
+    return;
+
+  goto_functions.update();
+
+  value_set_analysist value_set_analysis(ns, msg);
+  value_set_analysis(goto_functions);
+
+  resolve_function_pointers(value_set_analysis, goto_functions, ns, msg);
+}
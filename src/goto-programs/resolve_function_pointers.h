@@ -0,0 +1,48 @@
+/*******************************************************************\
+
+Module: Static Resolution of Function Pointer Calls
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_PROGRAMS_RESOLVE_FUNCTION_POINTERS_H
+#define CPROVER_GOTO_PROGRAMS_RESOLVE_FUNCTION_POINTERS_H
+
+#include <goto-programs/goto_functions.h>
+#include <pointer-analysis/value_sets.h>
+#include <util/message/message.h>
+#include <util/namespace.h>
+
+/// Replaces calls through function pointers by direct calls, wherever the
+/// value sets narrow the pointer down to a few functions. A call through a
+/// pointer that can only point to f becomes a direct call to f. One that
+/// can point to f or g is dispatched as
+///
+///   if(fp == &f) f(...); else g(...);
+///
+/// When the value sets also allow the pointer to be NULL or invalid, the
+/// original indirect call is kept as the last branch, so that symex still
+/// checks it. When they say nothing about the pointer, the candidates are
+/// the functions with a compatible signature whose address is taken in the
+/// program, again with the indirect call as the last branch.
+///
+/// The value sets don't see other threads. Whenever the program starts
+/// threads, or the pointer is a global that is also written in a function
+/// not connected to the call site through direct calls, the indirect call
+/// is kept as the last branch as well.
+///
+/// Sites with more than a few candidates, or with candidates without a
+/// body, are left for symex to resolve.
+void resolve_function_pointers(
+  value_setst &value_sets,
+  goto_functionst &goto_functions,
+  const namespacet &ns,
+  const messaget &msg);
+
+/// Runs the value set analysis and the above, if there are any calls
+/// through function pointers at all
+void resolve_function_pointers(
+  goto_functionst &goto_functions,
+  const namespacet &ns,
+  const messaget &msg);
+
+#endif
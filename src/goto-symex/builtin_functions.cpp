@@ -28,6 +28,23 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/std_types.h>
 #include <vector>
 
+/** Size in bytes of a new object of type new_type, unless given explicitly */
+static expr2tc object_size(const type2tc &new_type, const expr2tc &size)
+{
+  if(!is_nil_expr(size))
+    return size;
+
+  try
+  {
+    BigInt object_size = type_byte_size(new_type);
+    return constant_int2tc(uint_type2(), object_size.to_uint64());
+  }
+  catch(array_type2t::dyn_sized_array_excp *e)
+  {
+    return typecast2tc(uint_type2(), e->size);
+  }
+}
+
 expr2tc goto_symext::symex_malloc(const expr2tc &lhs, const sideeffect2t &code)
 {
   return symex_mem(true, lhs, code);
@@ -80,6 +97,13 @@ void goto_symext::symex_realloc(const expr2tc &lhs, const sideeffect2t &code)
     cur_num++;
     std::map<expr2tc, unsigned>::value_type v(item.object, cur_num);
     cur_state->realloc_map.insert(v);
+
+    // The pointers from before the realloc still name the same object, so
+    // its own allocation state can't tell them apart from the new one. Only
+    // the tracking arrays, indexed by the renumbered pointer object, can.
+    expr2tc base = get_base_object(item.object);
+    if(is_symbol2t(base))
+      realloced_objects.insert(to_symbol2t(base).thename);
   }
 
   // Rebuild a gigantic if-then-else chain from the result list.
@@ -214,6 +238,8 @@ expr2tc goto_symext::symex_mem(
 
   pointer_object2tc ptr_obj(pointer_type2(), ptr_rhs);
   track_new_pointer(ptr_obj, new_type);
+  if(per_object_alloc_state)
+    track_new_object(symbol, new_type, expr2tc());
 
   dynamic_memory.emplace_back(
     rhs_copy, alloc_guard, !is_malloc, symbol.name.as_string());
@@ -252,25 +278,88 @@ void goto_symext::track_new_pointer(
   symbol2tc sz_sym(sz_sym_type, alloc_size_arr_name);
   index2tc sz_index_expr(get_bool_type(), sz_sym, ptr_obj);
 
-  expr2tc object_size_exp;
-  if(is_nil_expr(size))
+  expr2tc object_size_exp = object_size(new_type, size);
+  symex_assign(code_assign2tc(sz_index_expr, object_size_exp), true);
+}
+
+void goto_symext::track_new_object(
+  const symbolt &obj,
+  const type2tc &new_type,
+  const expr2tc &size)
+{
+  // Each property gets a symbol of its own, named after the object; they
+  // aren't program variables, so they don't cause any interleavings.
+  const std::pair<const char *, typet> props[] = {
+    {"valid", bool_typet()}, {"deallocd", bool_typet()}, {"size", uint_type()}};
+
+  for(auto const &prop : props)
   {
-    try
-    {
-      BigInt object_size = type_byte_size(new_type);
-      object_size_exp = constant_int2tc(uint_type2(), object_size.to_uint64());
-    }
-    catch(array_type2t::dyn_sized_array_excp *e)
-    {
-      object_size_exp = typecast2tc(uint_type2(), e->size);
-    }
+    symbolt state;
+    state.name = id2string(obj.name) + "$" + prop.first;
+    state.id = id2string(obj.id) + "$" + prop.first;
+    state.type = prop.second;
+    state.lvalue = true;
+    state.mode = obj.mode;
+    new_context.add(state);
   }
-  else
+
+  symbol2tc obj_sym(new_type, obj.id);
+  address_of2tc addrof(type2tc(new pointer_type2t(new_type)), obj_sym);
+  set_alloc_state(addrof, true, object_size(new_type, size), gen_true_expr());
+}
+
+void goto_symext::set_alloc_state(
+  const expr2tc &obj,
+  bool valid,
+  const expr2tc &size,
+  const expr2tc &guard)
+{
+  expr2tc valid_sym = get_alloc_state(obj, "valid");
+  if(is_nil_expr(valid_sym))
+    return;
+
+  guardt g;
+  g.add(guard);
+
+  expr2tc truth = gen_true_expr();
+  expr2tc falsity = gen_false_expr();
+  symex_assign(code_assign2tc(valid_sym, valid ? truth : falsity), true, g);
+  symex_assign(
+    code_assign2tc(get_alloc_state(obj, "deallocd"), valid ? falsity : truth),
+    true,
+    g);
+
+  if(!is_nil_expr(size))
   {
-    object_size_exp = size;
+    expr2tc sz = size;
+    if(sz->type != uint_type2())
+      sz = typecast2tc(uint_type2(), sz);
+    symex_assign(code_assign2tc(get_alloc_state(obj, "size"), sz), true, g);
   }
+}
 
-  symex_assign(code_assign2tc(sz_index_expr, object_size_exp), true);
+expr2tc
+goto_symext::get_alloc_state(const expr2tc &ptr, const std::string &what) const
+{
+  if(!per_object_alloc_state)
+    return expr2tc();
+
+  if(is_typecast2t(ptr))
+    return get_alloc_state(to_typecast2t(ptr).from, what);
+
+  expr2tc obj = ptr;
+  if(is_address_of2t(obj))
+    obj = get_base_object(to_address_of2t(obj).ptr_obj);
+
+  if(!is_symbol2t(obj) || realloced_objects.count(to_symbol2t(obj).thename))
+    return expr2tc();
+
+  const symbolt *s =
+    new_context.find_symbol(to_symbol2t(obj).thename.as_string() + "$" + what);
+  if(s == nullptr)
+    return expr2tc();
+
+  return symbol2tc(migrate_type(s->type), s->id);
 }
 
 void goto_symext::symex_free(const expr2tc &expr)
@@ -330,6 +419,11 @@ void goto_symext::symex_free(const expr2tc &expr)
     }
   }
 
+  // Objects with their own allocation state are freed one by one, under the
+  // condition that the pointer points at them.
+  for(auto const &item : internal_deref_items)
+    set_alloc_state(item.object, false, expr2tc(), item.guard);
+
   // Clear the alloc bit, and set the deallocated bit.
   type2tc sym_type =
     type2tc(new array_type2t(get_bool_type(), expr2tc(), true));
@@ -703,6 +797,39 @@ void goto_symext::intrinsic_kill_monitor(reachability_treet &art)
   ex_state.kill_monitor_thread();
 }
 
+void goto_symext::intrinsic_mutex_lock(const code_function_call2t &call)
+{
+  // Intrinsics run even when the guard is false
+  if(cur_state->guard.is_false())
+    return;
+
+  // Symex runs this in one go, so no other thread can take the lock between
+  // the test and the set, and nothing needs to be atomic.
+  const expr2tc &ptr = call.operands[0];
+  expr2tc lock = dereference2tc(to_pointer_type(ptr->type).subtype, ptr);
+
+  // A lock held by another thread blocks this one for the rest of this
+  // interleaving, see execution_statet::is_thread_blocked
+  expr2tc held = lock;
+  dereference(held, dereferencet::READ);
+  assume(equality2tc(held, gen_zero(held->type)));
+
+  dereference(lock, dereferencet::WRITE);
+  symex_assign(code_assign2tc(lock, gen_one(lock->type)), true);
+}
+
+void goto_symext::intrinsic_mutex_unlock(const code_function_call2t &call)
+{
+  if(cur_state->guard.is_false())
+    return;
+
+  const expr2tc &ptr = call.operands[0];
+  expr2tc lock = dereference2tc(to_pointer_type(ptr->type).subtype, ptr);
+
+  dereference(lock, dereferencet::WRITE);
+  symex_assign(code_assign2tc(lock, gen_zero(lock->type)), true);
+}
+
 void goto_symext::symex_va_arg(const expr2tc &lhs, const sideeffect2t &code)
 {
   // Get symbol
@@ -22,6 +22,37 @@ void goto_symext::default_replace_dynamic_allocation(expr2tc &expr)
       default_replace_dynamic_allocation(e);
   });
 
+  // Dynamic objects with their own allocation state, if any, are looked up
+  // directly rather than through the tracking arrays.
+  if(is_valid_object2t(expr))
+  {
+    expr2tc state = get_alloc_state(to_valid_object2t(expr).value, "valid");
+    if(!is_nil_expr(state))
+    {
+      expr = state;
+      return;
+    }
+  }
+  else if(is_deallocated_obj2t(expr))
+  {
+    expr2tc state =
+      get_alloc_state(to_deallocated_obj2t(expr).value, "deallocd");
+    if(!is_nil_expr(state))
+    {
+      expr = state;
+      return;
+    }
+  }
+  else if(is_dynamic_size2t(expr))
+  {
+    expr2tc state = get_alloc_state(to_dynamic_size2t(expr).value, "size");
+    if(!is_nil_expr(state))
+    {
+      expr = state;
+      return;
+    }
+  }
+
   if(is_valid_object2t(expr))
   {
     // replace with CPROVER_alloc[POINTER_OBJECT(...)]
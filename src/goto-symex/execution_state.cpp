@@ -50,6 +50,7 @@ execution_statet::execution_statet(
 {
   art1 = owning_rt;
   CS_number = 0;
+  preemption_number = 0;
   node_id = 0;
   tid_is_set = false;
   monitor_tid = 0;
@@ -97,6 +98,7 @@ execution_statet::execution_statet(
   }
 
   thread_start_data.emplace_back();
+  thread_spawned_unguarded.push_back(false);
 
   // Initial mpor tracking.
   thread_last_reads.emplace_back();
@@ -152,6 +154,7 @@ execution_statet &execution_statet::operator=(const execution_statet &ex)
   atomic_numbers = ex.atomic_numbers;
   DFS_traversed = ex.DFS_traversed;
   thread_start_data = ex.thread_start_data;
+  thread_spawned_unguarded = ex.thread_spawned_unguarded;
   last_active_thread = ex.last_active_thread;
   last_insn = ex.last_insn;
   active_thread = ex.active_thread;
@@ -175,6 +178,7 @@ execution_statet &execution_statet::operator=(const execution_statet &ex)
   no_return_value_opt = ex.no_return_value_opt;
 
   CS_number = ex.CS_number;
+  preemption_number = ex.preemption_number;
 
   thread_last_reads = ex.thread_last_reads;
   thread_last_writes = ex.thread_last_writes;
@@ -252,7 +256,9 @@ void execution_statet::symex_step(reachability_treet &art)
     state.value_set.dump();
   }
 
-  if(symex_trace || options.get_bool_option("show-symex-value-sets"))
+  if(
+    (symex_trace || options.get_bool_option("show-symex-value-sets")) &&
+    msg.is_enabled(VerbosityLevel::Result))
   {
     std::ostringstream oss;
     state.source.pc->output_instruction(ns, "", oss, msg, false);
@@ -428,6 +434,85 @@ bool execution_statet::dfs_explore_thread(unsigned int tid)
   return true;
 }
 
+bool execution_statet::is_thread_blocked(unsigned int tid)
+{
+  statet &state = threads_state.at(tid);
+  if(state.call_stack.empty() || state.thread_ended)
+    return false;
+
+  const goto_programt::instructiont &insn = *state.source.pc;
+  if(!insn.is_function_call())
+    return false;
+
+  const code_function_call2t &call = to_code_function_call2t(insn.code);
+  if(!is_symbol2t(call.function) || call.operands.size() != 1)
+    return false;
+
+  const irep_idt &name = to_symbol2t(call.function).thename;
+  bool mutex_ptr = name == "c:@F@pthread_mutex_lock_noassert" ||
+                   name == "c:@F@pthread_mutex_lock_nocheck";
+  if(!mutex_ptr && name != "c:@F@__ESBMC_mutex_lock")
+    return false;
+
+  expr2tc ptr = call.operands[0];
+  state.rename(ptr);
+  do_simplify(ptr);
+  if(!is_address_of2t(ptr))
+    return false;
+
+  // Either the lock field itself, or the mutex it is part of
+  expr2tc lock = to_address_of2t(ptr).ptr_obj;
+  if(mutex_ptr)
+  {
+    if(!is_struct_type(lock))
+      return false;
+
+    const struct_type2t &type = to_struct_type(lock->type);
+    auto it = std::find(
+      type.member_names.begin(), type.member_names.end(), "__lock");
+    if(it == type.member_names.end())
+      return false;
+
+    lock = member2tc(
+      type.members[it - type.member_names.begin()], lock, "__lock");
+  }
+
+  state.rename(lock);
+  do_simplify(lock);
+  return is_constant_int2t(lock) && !to_constant_int2t(lock).value.is_zero();
+}
+
+bool execution_statet::is_thread_runnable(unsigned int tid)
+{
+  const statet &state = threads_state.at(tid);
+  return !state.call_stack.empty() && !state.thread_ended &&
+         !is_thread_blocked(tid);
+}
+
+bool execution_statet::is_thread_unstarted(unsigned int tid) const
+{
+  const statet &state = threads_state.at(tid);
+  return !state.thread_ended && !state.call_stack.empty() &&
+         state.source.pc == state.source.prog->instructions.begin();
+}
+
+bool execution_statet::is_symmetric_to_earlier_thread(unsigned int tid) const
+{
+  const expr2tc &data = thread_start_data.at(tid);
+  if(
+    is_nil_expr(data) || !thread_spawned_unguarded.at(tid) ||
+    !is_thread_unstarted(tid))
+    return false;
+
+  for(unsigned int other = 0; other < tid; other++)
+    if(
+      thread_spawned_unguarded[other] && thread_start_data[other] == data &&
+      is_thread_unstarted(other))
+      return true;
+
+  return false;
+}
+
 bool execution_statet::check_if_ileaves_blocked()
 {
   if(owning_rt->get_CS_bound() != -1 && CS_number >= owning_rt->get_CS_bound())
@@ -754,6 +839,7 @@ unsigned int execution_statet::add_thread(const goto_programt *prog)
   }
 
   thread_start_data.emplace_back();
+  thread_spawned_unguarded.push_back(cur_state->guard.is_true());
 
   // We invalidated all threads_state refs, so reset cur_state ptr.
   cur_state = &threads_state[active_thread];
@@ -1115,6 +1201,9 @@ crypto_hash execution_statet::update_hash_for_assignment(const expr2tc &rhs)
 
 void execution_statet::print_stack_traces(unsigned int indent) const
 {
+  if(!msg.is_enabled(VerbosityLevel::Status))
+    return;
+
   std::vector<goto_symex_statet>::const_iterator it;
   std::string spaces = std::string("");
   unsigned int i;
@@ -151,6 +151,19 @@ public:
     return CS_number;
   }
 
+  /** Increase number of preemptions this ex_state has taken */
+  void increment_preemption()
+  {
+    preemption_number++;
+  }
+
+  /** Get the number of preemptions performed by this ex_state: context
+   *  switches away from a thread that could have carried on running. */
+  int get_preemptions() const
+  {
+    return preemption_number;
+  }
+
   /** Reset record of what context switches were taken from this ex_state */
   void resetDFS_traversed()
   {
@@ -340,6 +353,45 @@ public:
    */
   bool dfs_explore_thread(unsigned int tid);
 
+  /**
+   *  Check whether a thread is about to take a mutex that is certainly held.
+   *  Such a thread can't make progress: switching to it would only produce
+   *  an interleaving whose guard is false, so it is better not explored.
+   *  Only looks at a thread stopped right before __ESBMC_mutex_lock or a
+   *  pthread_mutex_lock built on it; anything else is never blocked.
+   *  @param tid Thread ID to check.
+   *  @return True if the thread is blocked.
+   */
+  bool is_thread_blocked(unsigned int tid);
+
+  /**
+   *  Check whether a thread could take the next step: it hasn't ended, still
+   *  has code to run and isn't blocked. Switching away from the active thread
+   *  while it is runnable is a preemption.
+   *  @param tid Thread ID to check.
+   *  @return True if the thread is runnable.
+   */
+  bool is_thread_runnable(unsigned int tid);
+
+  /**
+   *  Check whether a thread is interchangeable with a lower numbered one.
+   *  Two threads are when neither has taken a step yet, both were spawned
+   *  unconditionally, and their start data (start function and argument) is
+   *  the same. Switching to either gives the same interleavings up to the
+   *  numbering of the threads, so only the lowest numbered one needs to be
+   *  explored.
+   *  @param tid Thread ID to check.
+   *  @return True if a lower numbered thread is interchangeable with tid.
+   */
+  bool is_symmetric_to_earlier_thread(unsigned int tid) const;
+
+  /**
+   *  Whether a thread has yet to take its first step.
+   *  @param tid Thread ID to check.
+   *  @return True if the thread is still at the start of its program.
+   */
+  bool is_thread_unstarted(unsigned int tid) const;
+
   /**
    *  Test to see if interleavings are blocked by the current state.
    *  There can be a variety of reasons why interleavings are blocked; there
@@ -522,6 +574,9 @@ public:
    *  is a workaround to prevent too much nondeterminism entering into the
    *  thread starting process. */
   std::vector<expr2tc> thread_start_data;
+  /** Whether each thread was spawned under a true guard. Only these can be
+   *  interchangeable, see is_symmetric_to_earlier_thread. */
+  std::vector<bool> thread_spawned_unguarded;
   /** Last active thread's ID. */
   unsigned int last_active_thread;
   /** Last executed insn -- sometimes necessary for analysis. */
@@ -575,6 +630,8 @@ public:
 protected:
   /** Number of context switches performed by this ex_state */
   int CS_number;
+  /** Number of those context switches that were preemptions */
+  int preemption_number;
   /** For each thread, a set of symbols that were read by the thread in the
    *  last transition (run). Renamed to level1, as that identifies each piece of
    *  data that could have storage in C. */
@@ -0,0 +1,145 @@
+/*******************************************************************\
+
+Module: Feature extraction for symex traces
+
+\*******************************************************************/
+
+#include <goto-symex/formula_features.h>
+#include <irep2/irep2_utils.h>
+#include <ostream>
+
+formula_featurest::formula_featurest()
+  : size(0),
+    assertions(0),
+    arrays(0),
+    fp(0),
+    nonlinear_mul(0),
+    max_width(0),
+    wide_bv(0)
+{
+}
+
+void formula_featurest::add(const symex_target_equationt &eq)
+{
+  for(const auto &step : eq.SSA_steps)
+  {
+    if(step.ignore)
+      continue;
+
+    add(step.guard);
+    if(step.is_assignment())
+    {
+      add(step.lhs);
+      add(step.rhs);
+    }
+    else if(step.is_assert() || step.is_assume())
+    {
+      add(step.cond);
+      if(step.is_assert())
+        assertions++;
+    }
+  }
+}
+
+void formula_featurest::add(const expr2tc &expr)
+{
+  if(is_nil_expr(expr) || !visited.insert(expr.get()).second)
+    return;
+
+  size++;
+  expr_kinds[get_expr_id(expr)]++;
+
+  const type2tc &type = expr->type;
+  if(is_array_type(type))
+    arrays++;
+  else if(is_floatbv_type(type))
+    fp++;
+  else if(is_bv_type(type) || is_fixedbv_type(type))
+  {
+    unsigned int width = type->get_width();
+    bv_widths[width]++;
+    max_width = std::max(max_width, width);
+    if(width > 64)
+      wide_bv++;
+  }
+
+  if(is_mul2t(expr) || is_div2t(expr) || is_modulus2t(expr))
+  {
+    const expr2tc &side_1 = *expr->get_sub_expr(0);
+    const expr2tc &side_2 = *expr->get_sub_expr(1);
+    if(!is_constant_expr(side_1) && !is_constant_expr(side_2))
+      nonlinear_mul++;
+  }
+  else if(is_ieee_mul2t(expr) || is_ieee_div2t(expr))
+  {
+    const ieee_arith_2ops &arith = static_cast<const ieee_arith_2ops &>(*expr);
+    if(!is_constant_expr(arith.side_1) && !is_constant_expr(arith.side_2))
+      nonlinear_mul++;
+  }
+
+  expr->foreach_operand([this](const expr2tc &e) { add(e); });
+}
+
+BigInt formula_featurest::get(const std::string &name) const
+{
+  if(name == "size")
+    return size;
+  if(name == "assertions")
+    return assertions;
+  if(name == "arrays")
+    return arrays;
+  if(name == "fp")
+    return fp;
+  if(name == "nonlinear-mul")
+    return nonlinear_mul;
+  if(name == "max-width")
+    return max_width;
+  if(name == "wide-bv")
+    return wide_bv;
+
+  auto it = expr_kinds.find(name);
+  return it == expr_kinds.end() ? 0 : it->second;
+}
+
+bool formula_featurest::is_feature(const std::string &name)
+{
+  static const char *fixed[] = {
+    "size",
+    "assertions",
+    "arrays",
+    "fp",
+    "nonlinear-mul",
+    "max-width",
+    "wide-bv"};
+  for(const char *f : fixed)
+    if(name == f)
+      return true;
+
+  for(unsigned int i = 0; i < expr2t::end_expr_id; i++)
+    if(name == get_expr_id(static_cast<expr2t::expr_ids>(i)))
+      return true;
+
+  return false;
+}
+
+void formula_featurest::output(std::ostream &out) const
+{
+  out << "Formula features:\n";
+  out << "  size: " << size << "\n";
+  out << "  assertions: " << assertions << "\n";
+  out << "  arrays: " << arrays << "\n";
+  out << "  fp: " << fp << "\n";
+  out << "  nonlinear-mul: " << nonlinear_mul << "\n";
+  out << "  max-width: " << max_width << "\n";
+  out << "  wide-bv: " << wide_bv << "\n";
+
+  out << "  bit-widths:";
+  for(const auto &w : bv_widths)
+    out << " " << w.first << ":" << w.second;
+  out << "\n";
+
+  out << "  expressions:";
+  for(const auto &k : expr_kinds)
+    out << " " << k.first << ":" << k.second;
+  out << "\n";
+}
@@ -0,0 +1,53 @@
+/*******************************************************************\
+
+Module: Feature extraction for symex traces
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_SYMEX_FORMULA_FEATURES_H
+#define CPROVER_GOTO_SYMEX_FORMULA_FEATURES_H
+
+#include <goto-symex/symex_target_equation.h>
+#include <iosfwd>
+#include <map>
+#include <unordered_set>
+
+/// Cheap syntactic measurements of the part of an equation that will be
+/// handed to the solver, used to pick a solving strategy per query.
+class formula_featurest
+{
+public:
+  formula_featurest();
+
+  void add(const symex_target_equationt &eq);
+  void add(const expr2tc &expr);
+
+  /// Look up a feature by name: "size", "assertions", "arrays", "fp",
+  /// "nonlinear-mul", "max-width", "wide-bv", or the name of an expression
+  /// kind (e.g. "bitand", "with") for its number of occurrences. Unknown
+  /// names evaluate to zero.
+  BigInt get(const std::string &name) const;
+
+  /// Whether get() knows the feature, rather than defaulting it to zero
+  static bool is_feature(const std::string &name);
+
+  void output(std::ostream &out) const;
+
+  // Number of distinct nodes
+  unsigned size;
+  unsigned assertions;
+  unsigned arrays;
+  unsigned fp;
+  unsigned nonlinear_mul;
+  unsigned max_width;
+  // Bit-vectors wider than 64 bits
+  unsigned wide_bv;
+
+  std::map<std::string, unsigned> expr_kinds;
+  std::map<unsigned, unsigned> bv_widths;
+
+protected:
+  std::unordered_set<const expr2t *> visited;
+};
+
+#endif
@@ -14,6 +14,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <goto-symex/symex_target.h>
 #include <map>
 #include <pointer-analysis/dereference.h>
+#include <set>
 #include <stack>
 #include <util/i2string.h>
 #include <irep2/irep2.h>
@@ -446,6 +447,11 @@ protected:
     reachability_treet &art);
   /** Terminate the monitor thread */
   void intrinsic_kill_monitor(reachability_treet &art);
+  /** Wait for the mutex lock field pointed to by the argument to be clear,
+   *  and set it, in a single step. */
+  void intrinsic_mutex_lock(const code_function_call2t &call);
+  /** Clear the mutex lock field pointed to by the argument. */
+  void intrinsic_mutex_unlock(const code_function_call2t &call);
   /** Memset optimiser */
   void intrinsic_memset(
     reachability_treet &art,
@@ -744,6 +750,22 @@ protected:
     const expr2tc &ptr_obj,
     const type2tc &new_type,
     const expr2tc &size = expr2tc());
+  /** Create the per-object allocation state of a new dynamic object. */
+  void track_new_object(
+    const symbolt &obj,
+    const type2tc &new_type,
+    const expr2tc &size);
+  /** Update the per-object allocation state of obj, if it has one, where
+   *  guard holds. A nil size leaves the size alone. */
+  void set_alloc_state(
+    const expr2tc &obj,
+    bool valid,
+    const expr2tc &size,
+    const expr2tc &guard);
+  /** Symbol holding the given allocation property ("valid", "deallocd" or
+   *  "size") of what ptr points to, when ptr is the address of a dynamic
+   *  object that has per-object allocation state; nil otherwise. */
+  expr2tc get_alloc_state(const expr2tc &ptr, const std::string &what) const;
   /** Symbolic implementation of free */
   void symex_free(const expr2tc &expr);
   /** Symbolic implementation of c++'s delete. */
@@ -854,6 +876,13 @@ protected:
   /** Flag as to whether we're performing memory leak checks. Corresponds to
    *  the option --memory-leak-check */
   bool memory_leak_check;
+  /** Flag as to whether dynamic objects keep their allocation state in their
+   *  own symbols. Corresponds to the option --per-object-alloc-state */
+  bool per_object_alloc_state;
+  /** Dynamic objects that have been realloc'd. They go back to the tracking
+   *  arrays, as their own allocation state can't tell stale pointers to them
+   *  from the ones realloc returned. */
+  std::set<irep_idt> realloced_objects;
   /** Flag as to whether we're checking user assertions. Corresponds to
    *  the option --no-assertions */
   bool no_assertions;
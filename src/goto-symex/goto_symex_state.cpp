@@ -73,6 +73,11 @@ void goto_symex_statet::initialize(
   top().calling_location = symex_targett::sourcet(top().end_of_function, prog);
 }
 
+// Longest chain of constant updates of an array_of that is propagated. Past
+// it, every further update would copy the whole chain, and the elements are
+// better read from the array shadow.
+static const unsigned int max_sparse_updates = 16;
+
 bool goto_symex_statet::constant_propagation(const expr2tc &expr) const
 {
   if(is_array_type(expr))
@@ -135,12 +140,27 @@ bool goto_symex_statet::constant_propagation(const expr2tc &expr) const
       return true;
   }
 
-  // Keeping additional with data achieves nothing; no code in ESBMC inspects
-  // with chains to extract data from them.
+  // Keeping additional with data generally achieves nothing. The exception
+  // are a few constant updates of an array_of, which is how large, mostly
+  // uniform arrays are initialised: index simplification sees through those.
   // FIXME: actually benchmark this and look at timing results, it may be
   // important benchmarks (i.e. TACAS) work better with some propagation
   if(is_with2t(expr))
-    return false;
+  {
+    expr2tc e = expr;
+    for(unsigned int n = 0; is_with2t(e); n++)
+    {
+      if(n == max_sparse_updates)
+        return false;
+
+      const with2t &w = to_with2t(e);
+      if(!is_constant_int2t(w.update_field) || !is_constant_expr(w.update_value))
+        return false;
+      e = w.source_value;
+    }
+
+    return is_constant_array_of2t(e) && constant_propagation(e);
+  }
 
   if(
     is_constant_struct2t(expr) || is_constant_union2t(expr) ||
@@ -198,9 +218,16 @@ void goto_symex_statet::assignment(expr2tc &lhs, const expr2tc &rhs)
     top().level1.get_ident_name(lhs);
 
   expr2tc l1_lhs = lhs;
+  renaming::level2t::name_record rec(lhs_sym);
 
   expr2tc const_value = constant_propagation(rhs) ? rhs : expr2tc();
+  renaming::level2t::array_shadow_ptrt shadow;
+  if(is_nil_expr(const_value) && is_array_type(lhs))
+    shadow = update_array_shadow(rec, rhs);
+
   level2.make_assignment(lhs, const_value, rhs);
+  if(shadow)
+    level2.set_shadow(rec, std::move(shadow));
 
   if(use_value_set)
   {
@@ -212,6 +239,89 @@ void goto_symex_statet::assignment(expr2tc &lhs, const expr2tc &rhs)
   }
 }
 
+renaming::level2t::array_shadow_ptrt goto_symex_statet::update_array_shadow(
+  const renaming::level2t::name_record &rec,
+  const expr2tc &rhs)
+{
+  // Same restrictions as for propagating whole arrays
+  if(!is_array_type(rhs))
+    return renaming::level2t::array_shadow_ptrt();
+
+  const array_type2t &arr = to_array_type(rhs->type);
+  if(arr.size_is_infinite || is_array_type(arr.subtype))
+    return renaming::level2t::array_shadow_ptrt();
+
+  // Guarded assignments are of the form "cond ? a WITH [...] : a": the
+  // updated elements are no longer known, but the other ones still are.
+  expr2tc base = rhs;
+  bool guarded = false;
+  if(is_if2t(rhs))
+  {
+    base = to_if2t(rhs).true_value;
+    guarded = true;
+  }
+
+  std::vector<const with2t *> updates;
+  while(is_with2t(base))
+  {
+    const with2t &w = to_with2t(base);
+    if(!is_constant_int2t(w.update_field))
+      return renaming::level2t::array_shadow_ptrt();
+
+    updates.push_back(&w);
+    base = w.source_value;
+  }
+
+  if(
+    updates.empty() || !is_symbol2t(base) ||
+    !level2.is_current(rec, to_symbol2t(base)))
+    return renaming::level2t::array_shadow_ptrt();
+
+  if(guarded && to_if2t(rhs).false_value != base)
+    return renaming::level2t::array_shadow_ptrt();
+
+  renaming::level2t::array_shadow_ptrt shadow = level2.take_shadow(rec);
+
+  // Innermost update first
+  for(auto it = updates.rbegin(); it != updates.rend(); it++)
+  {
+    const BigInt &idx = to_constant_int2t((*it)->update_field).value;
+    if(!guarded && constant_propagation((*it)->update_value))
+      (*shadow)[idx] = (*it)->update_value;
+    else
+      shadow->erase(idx);
+  }
+
+  return shadow;
+}
+
+expr2tc goto_symex_statet::read_array_shadow(const index2t &index)
+{
+  expr2tc idx = index.index;
+  if(!is_constant_int2t(idx))
+  {
+    simplify(idx);
+    if(!is_constant_int2t(idx))
+      return expr2tc();
+  }
+
+  expr2tc sym = index.source_value;
+  top().level1.rename(sym);
+  if(!is_symbol2t(sym))
+    return expr2tc();
+
+  // The shadow describes the current version of the array only, while an
+  // array that is already renamed may be any earlier one
+  const symbol2t &s = to_symbol2t(sym);
+  renaming::level2t::name_record rec(s);
+  if(
+    (s.rlevel == symbol2t::level2 || s.rlevel == symbol2t::level2_global) &&
+    !level2.is_current(rec, s))
+    return expr2tc();
+
+  return level2.get_shadow_element(rec, to_constant_int2t(idx).value);
+}
+
 void goto_symex_statet::rename_type(expr2tc &expr)
 {
   if(is_nil_expr(expr))
@@ -255,6 +365,20 @@ void goto_symex_statet::rename(expr2tc &expr)
     address_of2t &addrof = to_address_of2t(expr);
     rename_address(addrof.ptr_obj);
   }
+  else if(is_index2t(expr) && is_symbol2t(to_index2t(expr).source_value))
+  {
+    // Constant indexes of arrays may be known without reading the array
+    index2t &index = to_index2t(expr);
+    rename(index.index);
+    expr2tc value = read_array_shadow(index);
+    if(!is_nil_expr(value))
+    {
+      expr = value;
+      return;
+    }
+
+    rename(index.source_value);
+  }
   else
   {
     // do this recursively
@@ -381,6 +381,28 @@ public:
    */
   void assignment(expr2tc &lhs, const expr2tc &rhs);
 
+  /**
+   *  Work out the known elements of the array being assigned.
+   *  When rhs only updates constant indexes of the current version of the
+   *  array in rec, the elements known for that version carry over to the new
+   *  one, along with the constant values that were written.
+   *  @param rec L1 name of the array being assigned to.
+   *  @param rhs L2 renamed value being assigned.
+   *  @return Shadow for the new version, or null if nothing is known.
+   */
+  renaming::level2t::array_shadow_ptrt
+  update_array_shadow(
+    const renaming::level2t::name_record &rec,
+    const expr2tc &rhs);
+
+  /**
+   *  Read a constant index of an array from its shadow.
+   *  @param index Index expression whose index is already renamed and whose
+   *         source is a symbol that is not yet.
+   *  @return The known element value, or nil.
+   */
+  expr2tc read_array_shadow(const index2t &index);
+
   /**
    *  Determine whether to constant propagate the value of an expression.
    *  These obey a few efficiency rules regarding whether or not its efficient
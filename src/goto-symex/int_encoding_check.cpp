@@ -0,0 +1,344 @@
+/*******************************************************************\
+
+Module: Integer encoding check for symex traces
+
+\*******************************************************************/
+
+#include <goto-symex/int_encoding_check.h>
+#include <irep2/irep2_utils.h>
+#include <util/arith_tools.h>
+
+int_encoding_checkt::intervalt
+int_encoding_checkt::type_range(const type2tc &type)
+{
+  if(is_bool_type(type))
+    return intervalt(BigInt(0), BigInt(1));
+
+  if(!is_bv_type(type))
+    return intervalt();
+
+  unsigned int width = type->get_width();
+  if(is_unsignedbv_type(type))
+    return intervalt(BigInt(0), power(2, width) - 1);
+
+  BigInt half = power(2, width - 1);
+  return intervalt(-half, half - 1);
+}
+
+bool int_encoding_checkt::fail(const std::string &why)
+{
+  if(reason.empty())
+    reason = why;
+  return false;
+}
+
+bool int_encoding_checkt::fits(const intervalt &range, const type2tc &type)
+{
+  if(!is_bv_type(type))
+    return true;
+
+  if(!range.lower_set || !range.upper_set)
+    return false;
+
+  intervalt bounds = type_range(type);
+  return range.lower >= bounds.lower && range.upper <= bounds.upper;
+}
+
+int_encoding_checkt::intervalt
+int_encoding_checkt::get_range(const expr2tc &expr)
+{
+  if(is_nil_expr(expr) || !reason.empty())
+    return intervalt();
+
+  if(is_floatbv_type(expr) || is_fixedbv_type(expr))
+  {
+    fail("floating-point arithmetic");
+    return intervalt();
+  }
+
+  switch(expr->expr_id)
+  {
+  case expr2t::constant_int_id:
+    return intervalt(to_constant_int2t(expr).value);
+
+  case expr2t::constant_bool_id:
+    return intervalt(BigInt(is_true(expr) ? 1 : 0));
+
+  case expr2t::symbol_id:
+  {
+    auto it = ranges.find(to_symbol2t(expr).get_symbol_name());
+    if(it != ranges.end())
+      return it->second;
+    return type_range(expr->type);
+  }
+
+  case expr2t::typecast_id:
+  {
+    const typecast2t &cast = to_typecast2t(expr);
+    intervalt from = get_range(cast.from);
+    if(
+      !is_bv_type(expr) ||
+      !(is_bv_type(cast.from) || is_bool_type(cast.from)))
+      return type_range(expr->type);
+
+    // Integer mode ignores bit widths in casts, which is only correct if the
+    // value is representable in the target type
+    if(!fits(from, expr->type))
+      fail("narrowing or sign-changing typecast");
+    return from;
+  }
+
+  case expr2t::if_id:
+  {
+    const if2t &i = to_if2t(expr);
+    get_range(i.cond);
+    intervalt res = get_range(i.true_value);
+    res.join(get_range(i.false_value));
+    return res;
+  }
+
+  case expr2t::add_id:
+  case expr2t::sub_id:
+  case expr2t::mul_id:
+  case expr2t::div_id:
+  case expr2t::modulus_id:
+  case expr2t::neg_id:
+  case expr2t::abs_id:
+    return get_arith_range(expr);
+
+  case expr2t::bitand_id:
+  case expr2t::bitor_id:
+  case expr2t::bitxor_id:
+  case expr2t::bitnand_id:
+  case expr2t::bitnor_id:
+  case expr2t::bitnxor_id:
+  case expr2t::bitnot_id:
+  case expr2t::shl_id:
+  case expr2t::lshr_id:
+  case expr2t::ashr_id:
+  case expr2t::popcount_id:
+  case expr2t::bswap_id:
+  case expr2t::bitcast_id:
+  case expr2t::byte_extract_id:
+  case expr2t::byte_update_id:
+  case expr2t::concat_id:
+  case expr2t::extract_id:
+    fail("bit-level operation");
+    return intervalt();
+
+  default:
+    break;
+  }
+
+  expr->foreach_operand([this](const expr2tc &e) { get_range(e); });
+  return type_range(expr->type);
+}
+
+int_encoding_checkt::intervalt
+int_encoding_checkt::get_arith_range(const expr2tc &expr)
+{
+  if(!is_bv_type(expr))
+  {
+    // Pointer arithmetic is handled by the solver's own memory model
+    expr->foreach_operand([this](const expr2tc &e) { get_range(e); });
+    return intervalt();
+  }
+
+  intervalt res;
+  if(is_neg2t(expr) || is_abs2t(expr))
+  {
+    const expr2tc &value =
+      is_neg2t(expr) ? to_neg2t(expr).value : to_abs2t(expr).value;
+    intervalt a = get_range(value);
+    if(!a.lower_set || !a.upper_set)
+    {
+      fail("unbounded arithmetic");
+      return res;
+    }
+
+    if(is_neg2t(expr) || a.upper <= 0)
+      res = intervalt(-a.upper, -a.lower);
+    else if(a.lower >= 0)
+      res = a;
+    else
+      res = intervalt(BigInt(0), std::max(-a.lower, a.upper));
+  }
+  else
+  {
+    const expr2tc &side_1 = *expr->get_sub_expr(0);
+    const expr2tc &side_2 = *expr->get_sub_expr(1);
+    intervalt a = get_range(side_1);
+    intervalt b = get_range(side_2);
+    if(!a.lower_set || !a.upper_set || !b.lower_set || !b.upper_set)
+    {
+      fail("unbounded arithmetic");
+      return res;
+    }
+
+    switch(expr->expr_id)
+    {
+    case expr2t::add_id:
+      res = intervalt(a.lower + b.lower, a.upper + b.upper);
+      break;
+
+    case expr2t::sub_id:
+      res = intervalt(a.lower - b.upper, a.upper - b.lower);
+      break;
+
+    case expr2t::mul_id:
+    {
+      BigInt c[] = {
+        a.lower * b.lower,
+        a.lower * b.upper,
+        a.upper * b.lower,
+        a.upper * b.upper};
+      res =
+        intervalt(*std::min_element(c, c + 4), *std::max_element(c, c + 4));
+      break;
+    }
+
+    case expr2t::div_id:
+    case expr2t::modulus_id:
+      // C truncates towards zero, SMT integer division does not
+      if(a.lower < 0 || b.lower < 0)
+      {
+        fail("division with possibly negative operands");
+        return res;
+      }
+
+      if(is_div2t(expr))
+        res = intervalt(BigInt(0), a.upper);
+      else
+        res = intervalt(BigInt(0), std::max(BigInt(0), b.upper - 1));
+      break;
+
+    default:
+      assert(0 && "Unexpected arithmetic expression");
+    }
+  }
+
+  if(!fits(res, expr->type))
+    fail("arithmetic that may wrap around");
+  return res;
+}
+
+void int_encoding_checkt::assume(const expr2tc &cond)
+{
+  if(is_and2t(cond))
+  {
+    assume(to_and2t(cond).side_1);
+    assume(to_and2t(cond).side_2);
+    return;
+  }
+
+  if(!is_comp_expr(cond) || is_notequal2t(cond))
+    return;
+
+  expr2tc lhs = *cond->get_sub_expr(0);
+  expr2tc rhs = *cond->get_sub_expr(1);
+  expr2t::expr_ids id = cond->expr_id;
+
+  // Normalise to "symbol <op> constant"
+  if(is_constant_int2t(lhs) && is_symbol2t(rhs))
+  {
+    std::swap(lhs, rhs);
+    if(id == expr2t::lessthan_id)
+      id = expr2t::greaterthan_id;
+    else if(id == expr2t::greaterthan_id)
+      id = expr2t::lessthan_id;
+    else if(id == expr2t::lessthanequal_id)
+      id = expr2t::greaterthanequal_id;
+    else if(id == expr2t::greaterthanequal_id)
+      id = expr2t::lessthanequal_id;
+  }
+
+  if(!is_symbol2t(lhs) || !is_constant_int2t(rhs) || !is_bv_type(lhs))
+    return;
+
+  const BigInt &c = to_constant_int2t(rhs).value;
+  intervalt r = get_range(lhs);
+  switch(id)
+  {
+  case expr2t::lessthan_id:
+    r.make_le_than(c - 1);
+    break;
+  case expr2t::lessthanequal_id:
+    r.make_le_than(c);
+    break;
+  case expr2t::greaterthan_id:
+    r.make_ge_than(c + 1);
+    break;
+  case expr2t::greaterthanequal_id:
+    r.make_ge_than(c);
+    break;
+  case expr2t::equality_id:
+    r.make_le_than(c);
+    r.make_ge_than(c);
+    break;
+  default:
+    return;
+  }
+
+  ranges[to_symbol2t(lhs).get_symbol_name()] = r;
+}
+
+bool int_encoding_checkt::check(const symex_target_equationt &eq)
+{
+  reason.clear();
+  ranges.clear();
+
+  for(const auto &step : eq.SSA_steps)
+  {
+    if(step.ignore)
+      continue;
+
+    get_range(step.guard);
+
+    switch(step.type)
+    {
+    case goto_trace_stept::ASSIGNMENT:
+    {
+      get_range(step.lhs);
+      intervalt r = get_range(step.rhs);
+      if(is_symbol2t(step.lhs) && is_bv_type(step.lhs))
+      {
+        r.meet(type_range(step.lhs->type));
+        ranges[to_symbol2t(step.lhs).get_symbol_name()] = r;
+      }
+      break;
+    }
+
+    case goto_trace_stept::ASSUME:
+      get_range(step.cond);
+      // Unguarded assumptions constrain every later step
+      if(is_true(step.guard))
+        assume(step.cond);
+      break;
+
+    case goto_trace_stept::ASSERT:
+      get_range(step.cond);
+      break;
+
+    case goto_trace_stept::OUTPUT:
+      for(const auto &arg : step.output_args)
+        get_range(arg);
+      break;
+
+    default:
+      break;
+    }
+
+    if(!reason.empty())
+      return false;
+  }
+
+  return true;
+}
+
+bool can_use_int_encoding(const symex_target_equationt &eq, std::string &reason)
+{
+  int_encoding_checkt checker;
+  bool res = checker.check(eq);
+  reason = checker.reason;
+  return res;
+}
@@ -0,0 +1,45 @@
+/*******************************************************************\
+
+Module: Integer encoding check for symex traces
+
+\*******************************************************************/
+
+#ifndef CPROVER_GOTO_SYMEX_INT_ENCODING_CHECK_H
+#define CPROVER_GOTO_SYMEX_INT_ENCODING_CHECK_H
+
+#include <goto-programs/interval_template.h>
+#include <goto-symex/symex_target_equation.h>
+#include <unordered_map>
+
+/// Decides whether an equation can be encoded using integer/real arithmetic
+/// without changing its meaning. This is the case when the formula contains
+/// no bit-level operation (bitwise logic, shifts, byte operations, bitcasts,
+/// floating-point) and every integer operation is proven, by forward interval
+/// propagation over the SSA steps, to never leave the range of its type.
+class int_encoding_checkt
+{
+public:
+  typedef interval_templatet<BigInt> intervalt;
+
+  bool check(const symex_target_equationt &eq);
+
+  /// Why the last check failed; empty if it succeeded.
+  std::string reason;
+
+protected:
+  std::unordered_map<std::string, intervalt> ranges;
+
+  intervalt get_range(const expr2tc &expr);
+  intervalt get_arith_range(const expr2tc &expr);
+  void assume(const expr2tc &cond);
+  bool fits(const intervalt &range, const type2tc &type);
+  bool fail(const std::string &why);
+
+  static intervalt type_range(const type2tc &type);
+};
+
+bool can_use_int_encoding(
+  const symex_target_equationt &eq,
+  std::string &reason);
+
+#endif
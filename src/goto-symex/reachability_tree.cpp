@@ -45,12 +45,23 @@ reachability_treet::reachability_treet(
   context.move(sym);
 
   CS_bound = atoi(options.get_option("context-bound").c_str());
+  preemption_bound = -1;
+  min_preemptions = 0;
+  preemption_bound_hit = false;
   TS_slice = atoi(options.get_option("time-slice").c_str());
   state_hashing = options.get_bool_option("state-hashing");
   directed_interleavings = options.get_bool_option("direct-interleavings");
   interactive_ileaves = options.get_bool_option("interactive-ileaves");
   schedule = options.get_bool_option("schedule");
   por = !options.get_bool_option("no-por");
+  symmetry = options.get_bool_option("symmetry-reduction");
+  if(symmetry && program_observes_thread_ids())
+  {
+    message_handler.warning(
+      "Disabling symmetry reduction: the program observes thread IDs or "
+      "thread handles");
+    symmetry = false;
+  }
 
   target_template = std::move(target);
 }
@@ -118,6 +129,18 @@ int reachability_treet::get_CS_bound() const
   return CS_bound;
 }
 
+void reachability_treet::set_preemption_bound(int bound, int min)
+{
+  preemption_bound = bound;
+  min_preemptions = min;
+  preemption_bound_hit = false;
+}
+
+bool reachability_treet::is_preemption_bound_hit() const
+{
+  return preemption_bound_hit;
+}
+
 bool reachability_treet::check_for_hash_collision() const
 {
   const execution_statet &ex_state = get_cur_state();
@@ -155,8 +178,13 @@ void reachability_treet::create_next_state()
     execution_states.push_back(new_state);
 
     /* Make it active, make it follow on from previous state... */
-    if(new_state->get_active_state_number() != next_thread_id)
+    unsigned int active = new_state->get_active_state_number();
+    if(active != next_thread_id)
+    {
       new_state->increment_context_switch();
+      if(new_state->is_thread_runnable(active))
+        new_state->increment_preemption();
+    }
 
     new_state->switch_to_thread(next_thread_id);
     new_state->update_after_switch_point();
@@ -185,6 +213,8 @@ reachability_treet::decide_ileave_direction(execution_statet &ex_state)
     tid = get_ileave_direction_from_user();
     user_tid = tid;
   }
+  else if(preemption_bound != -1)
+    return decide_bounded_ileave_direction(ex_state);
 
   for(; tid < ex_state.threads_state.size(); tid++)
   {
@@ -192,6 +222,12 @@ reachability_treet::decide_ileave_direction(execution_statet &ex_state)
     if(!check_thread_viable(tid, true))
       continue;
 
+    if(ex_state.is_thread_blocked(tid))
+      continue;
+
+    if(symmetry && ex_state.is_symmetric_to_earlier_thread(tid))
+      continue;
+
     if(!ex_state.dfs_explore_thread(tid))
       continue;
 
@@ -214,6 +250,44 @@ reachability_treet::decide_ileave_direction(execution_statet &ex_state)
   return tid;
 }
 
+unsigned int
+reachability_treet::decide_bounded_ileave_direction(execution_statet &ex_state)
+{
+  unsigned int active = ex_state.get_active_state_number();
+  unsigned int num_threads = ex_state.threads_state.size();
+
+  std::vector<unsigned int> order = {active};
+  for(unsigned int tid = 0; tid < num_threads; tid++)
+    if(tid != active && ex_state.check_mpor_dependancy(active, tid))
+      order.push_back(tid);
+  for(unsigned int tid = 0; tid < num_threads; tid++)
+    if(tid != active && !ex_state.check_mpor_dependancy(active, tid))
+      order.push_back(tid);
+
+  bool preempts = ex_state.is_thread_runnable(active);
+  for(unsigned int tid : order)
+  {
+    if(!check_thread_viable(tid, true) || ex_state.is_thread_blocked(tid))
+      continue;
+
+    if(symmetry && ex_state.is_symmetric_to_earlier_thread(tid))
+      continue;
+
+    if(
+      tid != active && preempts &&
+      ex_state.get_preemptions() >= preemption_bound)
+    {
+      preemption_bound_hit = true;
+      continue;
+    }
+
+    if(ex_state.dfs_explore_thread(tid))
+      return tid;
+  }
+
+  return num_threads;
+}
+
 bool reachability_treet::is_has_complete_formula()
 {
   return has_complete_formula;
@@ -489,17 +563,153 @@ fail:
 
 void reachability_treet::print_ileave_trace() const
 {
+  if(!message_handler.is_enabled(VerbosityLevel::Status))
+    return;
+
   std::list<std::shared_ptr<execution_statet>>::const_iterator it;
   int i = 0;
 
   message_handler.status("Context switch trace for interleaving:");
   for(it = execution_states.begin(); it != execution_states.end(); it++, i++)
   {
-    message_handler.status(fmt::format("Context switch point {}", i));
+    message_handler.status_fmt("Context switch point {}", i);
     (*it)->print_stack_traces(4);
   }
 }
 
+static bool mentions_symbol(const expr2tc &expr, const irep_idt &name)
+{
+  if(is_nil_expr(expr))
+    return false;
+
+  if(is_symbol2t(expr) && to_symbol2t(expr).thename == name)
+    return true;
+
+  bool found = false;
+  expr->foreach_operand([&found, &name](const expr2tc &e) {
+    found = found || mentions_symbol(e, name);
+  });
+  return found;
+}
+
+static bool is_pthread_create(const expr2tc &code)
+{
+  if(!is_code_function_call2t(code))
+    return false;
+
+  const expr2tc &function = to_code_function_call2t(code).function;
+  return is_symbol2t(function) &&
+         to_symbol2t(function).thename == "c:@F@pthread_create";
+}
+
+/// The variable a pthread_t is stored into, when ptr is the address of (part
+/// of) one; empty otherwise
+static irep_idt handle_variable(const expr2tc &ptr)
+{
+  expr2tc e = ptr;
+  while(is_typecast2t(e))
+    e = to_typecast2t(e).from;
+
+  if(!is_address_of2t(e))
+    return irep_idt();
+
+  e = to_address_of2t(e).ptr_obj;
+  while(is_index2t(e) || is_member2t(e))
+    e = is_index2t(e) ? to_index2t(e).source_value
+                      : to_member2t(e).source_value;
+
+  return is_symbol2t(e) ? to_symbol2t(e).thename : irep_idt();
+}
+
+bool reachability_treet::program_observes_thread_ids() const
+{
+  const irep_idt end_values = "c:@__ESBMC_pthread_end_values";
+
+  // The variables the thread handles are stored into. Any use of them other
+  // than by pthread_create may tell threads apart: a join waits for one
+  // thread in particular, and comparisons or copies carry their identity.
+  std::set<irep_idt> handles;
+  forall_goto_functions(f_it, goto_functions)
+  {
+    if(f_it->second.body.hide)
+      continue;
+
+    forall_goto_program_instructions(i_it, f_it->second.body)
+    {
+      if(!is_pthread_create(i_it->code))
+        continue;
+
+      // Handles stored through a pointer could be read anywhere
+      const code_function_call2t &call = to_code_function_call2t(i_it->code);
+      irep_idt handle = handle_variable(call.operands.at(0));
+      if(handle.empty())
+        return true;
+      handles.insert(handle);
+    }
+  }
+
+  auto mentions_handle = [&handles](const expr2tc &expr) {
+    for(const irep_idt &h : handles)
+      if(mentions_symbol(expr, h))
+        return true;
+    return false;
+  };
+
+  forall_goto_functions(f_it, goto_functions)
+  {
+    forall_goto_program_instructions(i_it, f_it->second.body)
+    {
+      if(!f_it->second.body.hide)
+      {
+        // Inlined joins read the return values directly
+        if(
+          mentions_symbol(i_it->code, end_values) ||
+          mentions_symbol(i_it->guard, end_values))
+          return true;
+
+        if(mentions_handle(i_it->guard))
+          return true;
+
+        if(!is_pthread_create(i_it->code))
+        {
+          if(mentions_handle(i_it->code))
+            return true;
+        }
+        else
+        {
+          const code_function_call2t &call =
+            to_code_function_call2t(i_it->code);
+          if(mentions_handle(call.ret))
+            return true;
+          for(std::size_t i = 1; i < call.operands.size(); i++)
+            if(mentions_handle(call.operands[i]))
+              return true;
+        }
+      }
+
+      if(!i_it->is_function_call())
+        continue;
+
+      const code_function_call2t &call = to_code_function_call2t(i_it->code);
+      if(!is_symbol2t(call.function))
+        continue;
+
+      const irep_idt &callee = to_symbol2t(call.function).thename;
+      if(callee == "c:@F@pthread_self")
+        return true;
+
+      // The library keeps per-thread data by ID, which is symmetric, and is
+      // hidden; pthread_self only matters where it is called
+      if(
+        callee == "c:@F@__ESBMC_get_thread_id" && !f_it->second.body.hide &&
+        f_it->first != "c:@F@pthread_self")
+        return true;
+    }
+  }
+
+  return false;
+}
+
 bool reachability_treet::check_thread_viable(unsigned int tid, bool quiet) const
 {
   const execution_statet &ex = get_cur_state();
@@ -586,6 +796,16 @@ reachability_treet::get_next_formula()
 
   (*cur_state_it)->finish_formula();
 
+  if(get_cur_state().get_preemptions() < min_preemptions)
+  {
+    // An earlier preemption bound already covered this interleaving
+    symex_target_equationt *eq =
+      static_cast<symex_target_equationt *>((*cur_state_it)->target.get());
+    unsigned int num_asserts = eq->clear_assertions();
+    (*cur_state_it)->total_claims -= num_asserts;
+    (*cur_state_it)->remaining_claims -= num_asserts;
+  }
+
   has_complete_formula = false;
 
   return get_cur_state().get_symex_result();
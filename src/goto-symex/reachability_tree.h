@@ -119,6 +119,23 @@ public:
    */
   int get_CS_bound() const;
 
+  /**
+   *  Bound the number of preemptions in the interleavings explored from now
+   *  on, for iterative context bounding (--iterative-context-bound).
+   *  Interleavings with fewer than min_preemptions are still explored on the
+   *  way to the others, but their assertions are dropped, as they were
+   *  checked under an earlier bound.
+   *  @param bound Maximum number of preemptions; -1 for no limit.
+   *  @param min_preemptions Preemptions needed for assertions to be kept.
+   */
+  void set_preemption_bound(int bound, int min_preemptions);
+
+  /**
+   *  Whether the preemption bound has kept any interleaving from being
+   *  explored since it was set. If not, raising it would find nothing new.
+   */
+  bool is_preemption_bound_hit() const;
+
   /**
    *  Ask user for context switch to take.
    *  Enabled with --interactive-ileaves. Prints out a list of current thread
@@ -140,6 +157,18 @@ public:
    */
   bool check_thread_viable(unsigned int tid, bool quiet) const;
 
+  /**
+   *  Check whether the program may tell threads apart by their ID.
+   *  That is, whether it calls pthread_self, reads its thread ID outside the
+   *  hidden pthread library functions, or uses a thread handle after
+   *  pthread_create stored it: to join, detach or cancel the thread, in a
+   *  comparison, or by copying it elsewhere. Symmetry reduction is only
+   *  sound when it doesn't, since merging interchangeable threads permutes
+   *  their IDs.
+   *  @return True if thread IDs may be observed.
+   */
+  bool program_observes_thread_ids() const;
+
   /**
    *  Check whether current ex_state is a state hash collision.
    *  @return True if this state has already been visited
@@ -188,6 +217,18 @@ public:
    */
   unsigned int decide_ileave_direction(execution_statet &ex_state);
 
+  /**
+   *  Pick a context switch to take under a preemption bound.
+   *  Carrying on with the active thread is tried first, then switches to
+   *  threads whose last transition depends on the one just taken (they read
+   *  or wrote what it wrote, a lock it released for instance), then the
+   *  remaining ones. Preempting the active thread is refused once the bound
+   *  has been reached.
+   *  @param ex_state Execution state to analyse for switch direction
+   *  @return Thread ID of what thread to switch to next.
+   */
+  unsigned int decide_bounded_ileave_direction(execution_statet &ex_state);
+
   /**
    *  Prints state of execution_statet stack.
    *  Primarily for debugging; takes the current stack of execution_statet s
@@ -348,6 +389,12 @@ protected:
   std::shared_ptr<symex_targett> target_template;
   /** Limit on context switches; -1 for no limit */
   int CS_bound;
+  /** Limit on preemptions; -1 for no limit */
+  int preemption_bound;
+  /** Preemptions an interleaving needs for its assertions to be checked */
+  int min_preemptions;
+  /** Whether preemption_bound refused any context switch */
+  bool preemption_bound_hit;
   /** Limit on timeslices (--round-robin) */
   int TS_slice;
   /** Number of claims in current --schedule exploration */
@@ -358,6 +405,8 @@ protected:
   unsigned int next_thread_id;
   /** Whether partial-order-reduction is enabled */
   bool por;
+  /** Whether to skip threads interchangeable with a lower numbered one */
+  bool symmetry;
   /** Set of state hashes we've discovered */
   std::set<crypto_hash> hit_hashes;
   /** Message handler reference. */
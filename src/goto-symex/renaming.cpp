@@ -318,6 +318,96 @@ void renaming::level2t::make_assignment(
   symbol.node_num = entry.node_id;
 
   entry.constant = const_value;
+  // Whatever was known about the elements was about the previous version
+  entry.shadow.reset();
+}
+
+expr2tc renaming::level2t::get_shadow_element(
+  const name_record &rec,
+  const BigInt &idx) const
+{
+  current_namest::const_iterator it = current_names.find(rec);
+  if(it == current_names.end() || !it->second.shadow)
+    return expr2tc();
+
+  array_shadowt::const_iterator elem = it->second.shadow->find(idx);
+  if(elem == it->second.shadow->end())
+    return expr2tc();
+
+  return elem->second;
+}
+
+bool renaming::level2t::is_current(const name_record &rec, const symbol2t &sym)
+  const
+{
+  if(
+    sym.thename != rec.base_name || sym.level1_num != rec.l1_num ||
+    sym.thread_num != rec.t_num)
+    return false;
+
+  current_namest::const_iterator it = current_names.find(rec);
+  if(it == current_names.end())
+    return sym.level2_num == 0 && sym.node_num == 0;
+
+  return sym.level2_num == it->second.count &&
+         sym.node_num == it->second.node_id;
+}
+
+renaming::level2t::array_shadow_ptrt
+renaming::level2t::get_shadow(const name_record &rec) const
+{
+  current_namest::const_iterator it = current_names.find(rec);
+  if(it == current_names.end())
+    return array_shadow_ptrt();
+
+  return it->second.shadow;
+}
+
+void renaming::level2t::set_shadow(
+  const name_record &rec,
+  array_shadow_ptrt shadow)
+{
+  if(shadow && shadow->empty())
+    shadow.reset();
+
+  current_namest::iterator it = current_names.find(rec);
+  if(it != current_names.end())
+    it->second.shadow = std::move(shadow);
+}
+
+renaming::level2t::array_shadow_ptrt
+renaming::level2t::take_shadow(const name_record &rec)
+{
+  current_namest::iterator it = current_names.find(rec);
+  if(it == current_names.end() || !it->second.shadow)
+    return std::make_shared<array_shadowt>();
+
+  array_shadow_ptrt shadow = std::move(it->second.shadow);
+  if(shadow.use_count() != 1)
+    shadow = std::make_shared<array_shadowt>(*shadow);
+
+  return shadow;
+}
+
+renaming::level2t::array_shadow_ptrt renaming::level2t::meet_shadows(
+  const array_shadow_ptrt &a,
+  const array_shadow_ptrt &b)
+{
+  if(!a || !b)
+    return array_shadow_ptrt();
+
+  if(a == b)
+    return a;
+
+  array_shadow_ptrt res = std::make_shared<array_shadowt>();
+  for(const auto &elem : *a)
+  {
+    array_shadowt::const_iterator it = b->find(elem.first);
+    if(it != b->end() && it->second == elem.second)
+      res->insert(elem);
+  }
+
+  return res;
 }
 
 void renaming::level2t::rename_to_record(expr2tc &expr, const name_record &rec)
@@ -1,6 +1,8 @@
 #ifndef _GOTO_SYMEX_RENAMING_H_
 #define _GOTO_SYMEX_RENAMING_H_
 
+#include <map>
+#include <memory>
 #include <set>
 #include <boost/functional/hash.hpp>
 #include <util/crypto_hash.h>
@@ -249,16 +251,40 @@ public:
     renaming_levelt::get_original_name(expr, symbol2t::level1, msg);
   }
 
+  /** Known constant values of array elements, by index. */
+  typedef std::map<BigInt, expr2tc> array_shadowt;
+  typedef std::shared_ptr<array_shadowt> array_shadow_ptrt;
+
   struct valuet
   {
     unsigned count;
     expr2tc constant;
     unsigned node_id;
+    /** Elements of the current version of an array that are known, when the
+     *  array as a whole isn't constant. Shared with the copies of this state
+     *  made at branches, and only copied when one of them writes to it. */
+    array_shadow_ptrt shadow;
     valuet() : count(0), node_id(0)
     {
     }
   };
 
+  /** Known value of element idx of the current version of an array, or nil */
+  expr2tc get_shadow_element(const name_record &rec, const BigInt &idx) const;
+
+  /** Whether sym is the current l2 version of the variable in rec */
+  bool is_current(const name_record &rec, const symbol2t &sym) const;
+
+  array_shadow_ptrt get_shadow(const name_record &rec) const;
+  void set_shadow(const name_record &rec, array_shadow_ptrt shadow);
+
+  /** Take the shadow of rec out for updating it, copying it if shared */
+  array_shadow_ptrt take_shadow(const name_record &rec);
+
+  /** Elements known to have the same value in both shadows */
+  static array_shadow_ptrt
+  meet_shadows(const array_shadow_ptrt &a, const array_shadow_ptrt &b);
+
   void get_variables(std::set<name_record> &vars) const
   {
     for(const auto &current_name : current_names)
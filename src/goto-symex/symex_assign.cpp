@@ -45,6 +45,7 @@ goto_symext::goto_symext(
     depth_limit(atol(options.get_option("depth").c_str())),
     break_insn(atol(options.get_option("break-at").c_str())),
     memory_leak_check(options.get_bool_option("memory-leak-check")),
+    per_object_alloc_state(options.get_bool_option("per-object-alloc-state")),
     no_assertions(options.get_bool_option("no-assertions")),
     no_simplify(options.get_bool_option("no-simplify")),
     no_unwinding_assertions(options.get_bool_option("no-unwinding-assertions")),
@@ -107,6 +108,8 @@ goto_symext &goto_symext::operator=(const goto_symext &sym)
   depth_limit = sym.depth_limit;
   break_insn = sym.break_insn;
   memory_leak_check = sym.memory_leak_check;
+  per_object_alloc_state = sym.per_object_alloc_state;
+  realloced_objects = sym.realloced_objects;
   no_assertions = sym.no_assertions;
   no_simplify = sym.no_simplify;
   no_unwinding_assertions = sym.no_unwinding_assertions;
@@ -200,6 +200,7 @@ bool goto_symext::symex_throw()
   }
 
   // Log
+  if(msg.is_enabled(VerbosityLevel::Status))
   {
     std::ostringstream oss;
     oss << "*** Caught by catch(" << catch_name << ") at file "
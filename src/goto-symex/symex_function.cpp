@@ -234,9 +234,9 @@ void goto_symext::symex_function_call_code(const expr2tc &expr)
 
   if(!goto_function.body_available)
   {
-    msg.warning(fmt::format(
+    msg.warning_fmt(
       "**** WARNING: no body for function {}",
-      get_pretty_name(identifier.as_string())));
+      get_pretty_name(identifier.as_string()));
 
     /* TODO: if it is a C function with no prototype, assert/claim that all
      *       calls to this function have the same number of parameters and that
@@ -419,8 +419,7 @@ void goto_symext::symex_function_call_deref(const expr2tc &expr)
 
     if(fit == goto_functions.function_map.end() || !fit->second.body_available)
     {
-      msg.warning(
-        fmt::format("**** WARNING: no body for function {}", pretty_name));
+      msg.warning_fmt("**** WARNING: no body for function {}", pretty_name);
 
       continue; // XXX, find out why this fires on SV-COMP 14 benchmark
       // 32_7a_cilled_true_linux-3.8-rc1-drivers--ata--pata_legacy.ko-main.cil.out.c
@@ -394,9 +394,22 @@ void goto_symext::phi_function(const statet::goto_statet &goto_state)
     // to.
     renaming::level2t::rename_to_record(new_lhs, variable);
 
+    // Elements known to be the same on both paths stay known after the merge
+    renaming::level2t::array_shadow_ptrt shadow;
+    if(cur_state->guard.is_false())
+      shadow = goto_state.level2.get_shadow(variable);
+    else if(goto_state.guard.is_false())
+      shadow = cur_state->level2.get_shadow(variable);
+    else
+      shadow = renaming::level2t::meet_shadows(
+        goto_state.level2.get_shadow(variable),
+        cur_state->level2.get_shadow(variable));
+
     cur_state->rename_type(new_lhs);
     cur_state->rename_type(rhs);
     cur_state->assignment(new_lhs, rhs);
+    if(shadow && is_array_type(type))
+      cur_state->level2.set_shadow(variable, shadow);
 
     target->assignment(
       gen_true_expr(),
@@ -453,15 +466,15 @@ bool goto_symext::get_unwind(
     this_loop_max_unwind != 0 && unwind >= this_loop_max_unwind;
   if(!options.get_bool_option("quiet"))
   {
-    msg.status(fmt::format(
+    msg.status_fmt(
       stop_unwind ? "Not unwinding "
                   : "Unwinding "
                     "loop {} {} {} {} {}",
-      i2string(cur_state->source.pc->loop_number),
+      cur_state->source.pc->loop_number,
       " iteration ",
-      integer2string(unwind),
+      unwind,
       " ",
-      cur_state->source.pc->location.as_string()));
+      cur_state->source.pc->location);
   }
 
   return stop_unwind;
@@ -457,6 +457,14 @@ void goto_symext::run_intrinsic(
   {
     intrinsic_kill_monitor(art);
   }
+  else if(symname == "c:@F@__ESBMC_mutex_lock")
+  {
+    intrinsic_mutex_lock(func_call);
+  }
+  else if(symname == "c:@F@__ESBMC_mutex_unlock")
+  {
+    intrinsic_mutex_unlock(func_call);
+  }
   else if(symname == "c:@F@__ESBMC_memset")
   {
     intrinsic_memset(art, func_call);
@@ -587,8 +595,19 @@ void goto_symext::finish_formula()
     if(it.auto_deallocd)
       continue;
 
-    // Assert that the allocated object was freed.
-    deallocated_obj2tc deallocd(it.obj);
+    // Assert that the allocated object was freed. The allocation guard rules
+    // out the failed malloc alternative, so for objects with their own
+    // allocation state look at the allocated object alone.
+    expr2tc obj = it.obj;
+    expr2tc alloc = is_typecast2t(obj) ? to_typecast2t(obj).from : obj;
+    if(is_if2t(alloc))
+    {
+      const expr2tc &allocated = to_if2t(alloc).true_value;
+      if(!is_nil_expr(get_alloc_state(allocated, "deallocd")))
+        obj = allocated;
+    }
+
+    deallocated_obj2tc deallocd(obj);
 
     equality2tc eq(deallocd, gen_true_expr());
     replace_dynamic_allocation(eq);
@@ -170,7 +170,7 @@ void symex_target_equationt::convert_internal_step(
     return;
   }
 
-  if(ssa_trace)
+  if(ssa_trace && msg.is_enabled(VerbosityLevel::Status))
   {
     std::ostringstream oss;
     step.output(ns, oss, msg);
@@ -368,12 +368,11 @@ void symex_target_equationt::check_for_duplicate_assigns() const
   {
     if(it->second != 1)
     {
-      msg.status(
-        fmt::format("Symbol \"{}\" appears {} times", it->first, it->second));
+      msg.status_fmt("Symbol \"{}\" appears {} times", it->first, it->second);
     }
   }
 
-  msg.status(fmt::format("Checked {} insns", i));
+  msg.status_fmt("Checked {} insns", i);
 }
 
 unsigned int symex_target_equationt::clear_assertions()
@@ -25,12 +25,15 @@
 #include <boost/mpl/vector.hpp>
 #include <boost/preprocessor/list/adt.hpp>
 #include <boost/preprocessor/list/for_each.hpp>
+#include <atomic>
 #include <cstdarg>
 #include <functional>
+#include <memory>
 #include <util/config.h>
 #include <util/crypto_hash.h>
 #include <util/dstring.h>
 #include <util/irep.h>
+#include <util/irep_sharing.h>
 #include <vector>
 
 // Ahead of time: a list of all expressions and types, in a preprocessing
@@ -145,9 +148,46 @@ class type2t;
 class expr2t;
 class constant_array2t;
 
+/** Hash of a type2t or expr2t, cached in it once computed; zero until
+ *  then. Threads sharing a node may compute it at the same time, but they
+ *  all store the same value, so relaxed atomic accesses are enough, and
+ *  these cost no more than plain ones. Copies keep the cached value. */
+class irep2_crc_cachet
+{
+public:
+  irep2_crc_cachet() : val(0)
+  {
+  }
+
+  irep2_crc_cachet(const irep2_crc_cachet &ref) : val(ref.get())
+  {
+  }
+
+  irep2_crc_cachet &operator=(const irep2_crc_cachet &ref)
+  {
+    set(ref.get());
+    return *this;
+  }
+
+  size_t get() const
+  {
+    return val.load(std::memory_order_relaxed);
+  }
+
+  void set(size_t v)
+  {
+    val.store(v, std::memory_order_relaxed);
+  }
+
+protected:
+  std::atomic<size_t> val;
+};
+
 /** Reference counted container for expr2t based classes.
- *  This class extends boost shared_ptr's to contain anything that's a subclass
- *  of expr2t. It provides several ways of accessing the contained pointer;
+ *  This class is an intrusive pointer to anything that's a subclass of expr2t
+ *  or type2t: the reference count lives in the pointed-to object itself, so a
+ *  node is a single allocation and copying a container touches no control
+ *  block. It provides several ways of accessing the contained pointer;
  *  crucially it ensures that the only way to get a non-const reference or
  *  pointer is via the get() method, which call the detach() method.
  *
@@ -165,127 +205,167 @@ class constant_array2t;
  *  would be called, which duplicated the contained item and let the current
  *  piece of code modify the duplicate copy, while all the other storage
  *  locations continued to share the original.
- *
- *  So yeah, that's what this class attempts to implement, via the medium of
- *  boosts shared_ptr.
  */
 template <class T>
-class irep_container : public std::shared_ptr<T>
+class irep_container
 {
 public:
-  irep_container() : std::shared_ptr<T>()
+  irep_container() : ptr(nullptr)
   {
   }
 
   template <class Y>
-  explicit irep_container(Y *p) : std::shared_ptr<T>(p)
+  explicit irep_container(Y *p) : ptr(p)
   {
+    acquire();
   }
 
   template <class Y>
-  explicit irep_container(const Y *p) : std::shared_ptr<T>(const_cast<Y *>(p))
+  explicit irep_container(const Y *p) : ptr(const_cast<Y *>(p))
   {
+    acquire();
   }
 
-  // Copy construct from any std::shared_ptr of this type. That just copies
-  // a reference. Obviously this is fairly unwise because any std::shared_ptr
-  // won't be using the detach facility to manipulate things, however it's
-  // necessary for std::make_shared.
-  explicit irep_container(std::shared_ptr<T> &&p) : std::shared_ptr<T>(p)
+  irep_container(const irep_container &ref) : ptr(ref.ptr)
   {
+    acquire();
   }
 
-  irep_container(const irep_container &ref) : std::shared_ptr<T>(ref)
+  irep_container(irep_container &&ref) noexcept : ptr(ref.ptr)
   {
+    ref.ptr = nullptr;
   }
 
   template <class Y>
   irep_container(const irep_container<Y> &ref)
-    : std::shared_ptr<T>(static_cast<const std::shared_ptr<Y> &>(ref))
+    : ptr(static_cast<T *>(const_cast<Y *>(ref.get())))
   {
-    assert(dynamic_cast<const std::shared_ptr<T> &>(ref) != NULL);
+    assert(ref.get() == nullptr || dynamic_cast<const T *>(ref.get()));
+    acquire();
+  }
+
+  ~irep_container()
+  {
+    release();
   }
 
   irep_container &operator=(irep_container const &ref)
   {
-    std::shared_ptr<T>::operator=(ref);
+    irep_container(ref).swap(*this);
     return *this;
   }
 
-  template <class Y>
-  irep_container &operator=(std::shared_ptr<Y> const &r)
+  irep_container &operator=(irep_container &&ref) noexcept
   {
-    std::shared_ptr<T>::operator=(r);
-    T *p = std::shared_ptr<T>::operator->();
+    irep_container(std::move(ref)).swap(*this);
     return *this;
   }
 
   template <class Y>
   irep_container &operator=(const irep_container<Y> &ref)
   {
-    assert(dynamic_cast<const std::shared_ptr<T> &>(ref) != NULL);
-    *this = std::static_pointer_cast<T, Y>(
-      static_cast<const std::shared_ptr<Y> &>(ref));
+    irep_container(ref).swap(*this);
     return *this;
   }
 
+  void swap(irep_container &ref) noexcept
+  {
+    std::swap(ptr, ref.ptr);
+  }
+
+  void reset()
+  {
+    irep_container().swap(*this);
+  }
+
+  long use_count() const
+  {
+    return ptr ? ptr->refcount.get() : 0;
+  }
+
+  explicit operator bool() const
+  {
+    return ptr != nullptr;
+  }
+
+  bool operator==(std::nullptr_t) const
+  {
+    return ptr == nullptr;
+  }
+
+  bool operator!=(std::nullptr_t) const
+  {
+    return ptr != nullptr;
+  }
+
   irep_container simplify() const
   {
-    const T *foo = std::shared_ptr<T>::get();
-    return foo->simplify();
+    return ptr->simplify();
   }
 
   const T &operator*() const
   {
-    return *std::shared_ptr<T>::get();
+    return *ptr;
   }
 
   const T *operator->() const // never throws
   {
-    return std::shared_ptr<T>::operator->();
+    return ptr;
   }
 
   const T *get() const // never throws
   {
-    return std::shared_ptr<T>::get();
+    return ptr;
   }
 
   T *get() // never throws
   {
     detach();
-    T *tmp = std::shared_ptr<T>::get();
-    tmp->crc_val = 0;
-    return tmp;
+    ptr->crc_val.set(0);
+    return ptr;
   }
 
   T *operator->() // never throws
   {
     detach();
-    T *tmp = std::shared_ptr<T>::get();
-    tmp->crc_val = 0;
-    return tmp;
+    ptr->crc_val.set(0);
+    return ptr;
   }
 
   void detach()
   {
-    if(this->use_count() == 1)
+    if(use_count() == 1)
       return; // No point remunging oneself if we're the only user of the ptr.
 
     // Assign-operate ourself into containing a fresh copy of the data. This
     // creates a new reference counted object, and assigns it to ourself,
     // which causes the existing reference to be decremented.
-    const T *foo = std::shared_ptr<T>::get();
-    *this = foo->clone();
+    *this = ptr->clone();
   }
 
   size_t crc() const
   {
-    const T *foo = std::shared_ptr<T>::get();
-    if(foo->crc_val != 0)
-      return foo->crc_val;
+    size_t crc = ptr->crc_val.get();
+    if(crc != 0)
+      return crc;
 
-    return foo->do_crc();
+    return ptr->do_crc();
   }
+
+protected:
+  void acquire()
+  {
+    if(ptr)
+      ptr->refcount.incr();
+  }
+
+  void release()
+  {
+    if(ptr && ptr->refcount.decr())
+      delete ptr;
+  }
+
+  T *ptr;
 };
 
 typedef irep_container<type2t> type2tc;
@@ -298,7 +378,7 @@ typedef std::list<member_entryt> list_of_memberst;
  *  Contains only a type identifier enumeration - for some types (such as bool,
  *  or empty,) there's no need for any significant amount of data to be stored.
  */
-class type2t : public std::enable_shared_from_this<type2t>
+class type2t
 {
 public:
   /** Enumeration identifying each sort of type. */
@@ -336,9 +416,6 @@ public:
     }
   };
 
-  typedef std::function<void(const type2tc &t)> const_subtype_delegate;
-  typedef std::function<void(type2tc &t)> subtype_delegate;
-
 protected:
   /** Primary constructor.
    *  @param id Type ID of type being constructed
@@ -348,9 +425,6 @@ protected:
   /** Copy constructor */
   type2t(const type2t &ref) = default;
 
-  virtual void foreach_subtype_impl_const(const_subtype_delegate &t) const = 0;
-  virtual void foreach_subtype_impl(subtype_delegate &t) = 0;
-
 public:
   // Provide base / container types for some templates stuck on top:
   typedef type2tc container_type;
@@ -474,26 +548,20 @@ public:
    */
   virtual type2tc clone() const = 0;
 
-  // Please see the equivalent methods in expr2t for documentation
+  // Please see the equivalent methods in expr2t for documentation. These are
+  // defined at the bottom of irep2_type.h, once all types are complete.
   template <typename T>
-  void foreach_subtype(T &&t) const
-  {
-    const_subtype_delegate wrapped(std::cref(t));
-    foreach_subtype_impl_const(wrapped);
-  }
+  void foreach_subtype(T &&t) const;
 
   template <typename T>
-  void Foreach_subtype(T &&t)
-  {
-    subtype_delegate wrapped(std::ref(t));
-    foreach_subtype_impl(wrapped);
-  }
+  void Foreach_subtype(T &&t);
 
   /** Instance of type_ids recording this types type. */
   // XXX XXX XXX this should be const
   type_ids type_id;
 
-  mutable size_t crc_val;
+  mutable irep2_crc_cachet crc_val;
+  mutable irep_refcountt refcount;
 };
 
 /** Fetch identifying name for a type.
@@ -520,7 +588,7 @@ static inline std::string get_type_id(const type2tc &type)
  *  classes of expr, in addition we have a type as all exprs should have types.
  */
 class expr2t;
-class expr2t : public std::enable_shared_from_this<expr2t>
+class expr2t
 {
 public:
   /** Enumeration identifying each sort of expr.
@@ -539,9 +607,6 @@ public:
   /** Type for list of non-constant expr operands */
   typedef std::list<expr2tc *> Expr_operands;
 
-  typedef std::function<void(const expr2tc &expr)> const_op_delegate;
-  typedef std::function<void(expr2tc &expr)> op_delegate;
-
 protected:
   /** Primary constructor.
    *  @param type Type of this new expr
@@ -551,13 +616,15 @@ protected:
   /** Copy constructor */
   expr2t(const expr2t &ref);
 
-  virtual void foreach_operand_impl_const(const_op_delegate &expr) const = 0;
-  virtual void foreach_operand_impl(op_delegate &expr) = 0;
-
 public:
   // Provide base / container types for some templates stuck on top:
   typedef expr2tc container_type;
   typedef expr2t base_type;
+
+  /** Nodes are allocated through irep2_regiont, which hands them out from
+   *  the innermost open region if there is one. */
+  static void *operator new(std::size_t size);
+  static void operator delete(void *ptr, std::size_t size);
   // Also provide base traits
   typedef esbmct::expr2t_default_traits traits;
 
@@ -725,13 +792,16 @@ public:
    */
   virtual expr2tc do_simplify() const;
 
-  /** Indirect, abstract operand iteration.
+  /** Abstract operand iteration.
    *
    *  Provide a lambda-based accessor equivalent to the forall_operands2 macro
    *  where anonymous code (actually a delegate?) gets run over each operand
-   *  expression. Because the full type of the expression isn't known by the
-   *  caller, and each delegate is it's own type, we need to wrap it in a
-   *  std::function before funneling it through a virtual function.
+   *  expression. The full type of the expression isn't known by the caller,
+   *  so this switches on expr_id and hands the delegate, unwrapped, to a
+   *  visitor generated from the traits of the concrete class. Both the walk
+   *  over the fields and the delegate itself can then be inlined; nothing is
+   *  allocated and there is no virtual call. The definition lives at the
+   *  bottom of irep2_expr.h, where every expression class is complete.
    *
    *  For the purpose of this method, an operand is another instance of an
    *  expr2tc. This means the delegate will be called on any expr2tc field of
@@ -746,18 +816,10 @@ public:
    *           a type of void f(const expr2tc &)
    */
   template <typename T>
-  void foreach_operand(T &&t) const
-  {
-    const_op_delegate wrapped(std::cref(t));
-    foreach_operand_impl_const(wrapped);
-  }
+  void foreach_operand(T &&t) const;
 
   template <typename T>
-  void Foreach_operand(T &&t)
-  {
-    op_delegate wrapped(std::ref(t));
-    foreach_operand_impl(wrapped);
-  }
+  void Foreach_operand(T &&t);
 
   /** Instance of expr_ids recording tihs exprs type. */
   const expr_ids expr_id;
@@ -765,7 +827,8 @@ public:
   /** Type of this expr. All exprs have a type. */
   type2tc type;
 
-  mutable size_t crc_val;
+  mutable irep2_crc_cachet crc_val;
+  mutable irep_refcountt refcount;
 };
 
 inline bool is_nil_expr(const expr2tc &exp)
@@ -793,6 +856,12 @@ inline std::size_t hash_value(const expr2tc &expr)
  */
 std::string get_expr_id(const expr2t &expr);
 
+/** Fetch string identifier for a kind of expression.
+ *  Like the expr2t equivalent with the same name, but from the expr_ids
+ *  value alone.
+ */
+std::string get_expr_id(expr2t::expr_ids id);
+
 /** Fetch string identifier for an expression.
  *  Like the expr2t equivalent with the same name, but de-ensapculates an
  *  expr2tc.
@@ -887,6 +956,70 @@ public:
   typedef int type;
 };
 
+// Operand and subtype visitors over a single field. Fields that are neither
+// expressions nor types (or vectors thereof) are skipped.
+template <typename T, typename F>
+inline void visit_operand_field(T &, F &)
+{
+}
+
+template <typename F>
+inline void visit_operand_field(const expr2tc &e, F &f)
+{
+  f(e);
+}
+
+template <typename F>
+inline void visit_operand_field(expr2tc &e, F &f)
+{
+  f(e);
+}
+
+template <typename F>
+inline void visit_operand_field(const std::vector<expr2tc> &v, F &f)
+{
+  for(const expr2tc &e : v)
+    f(e);
+}
+
+template <typename F>
+inline void visit_operand_field(std::vector<expr2tc> &v, F &f)
+{
+  for(expr2tc &e : v)
+    f(e);
+}
+
+template <typename T, typename F>
+inline void visit_subtype_field(T &, F &)
+{
+}
+
+template <typename F>
+inline void visit_subtype_field(const type2tc &t, F &f)
+{
+  f(t);
+}
+
+template <typename F>
+inline void visit_subtype_field(type2tc &t, F &f)
+{
+  f(t);
+}
+
+template <typename F>
+inline void visit_subtype_field(const std::vector<type2tc> &v, F &f)
+{
+  for(const type2tc &t : v)
+    f(t);
+}
+
+template <typename F>
+inline void visit_subtype_field(std::vector<type2tc> &v, F &f)
+{
+  for(type2tc &t : v)
+    f(t);
+}
+
 /** Record for properties of an irep field.
  *  This type records, for any particular field:
  *    * It's type
@@ -1117,7 +1250,7 @@ protected:
     unsigned int indent) const;
   bool cmp_rec(const base2t &ref) const;
   int lt_rec(const base2t &ref) const;
-  void do_crc_rec() const;
+  void do_crc_rec(size_t &crc) const;
   void hash_rec(crypto_hash &hash) const;
 
   // These methods are specific to expressions rather than types, and are
@@ -1127,12 +1260,40 @@ protected:
   expr2tc *get_sub_expr_nc_rec(unsigned int cur_count, unsigned int desired);
   unsigned int get_num_sub_exprs_rec() const;
 
-  void foreach_operand_impl_rec(expr2t::op_delegate &f);
-  void foreach_operand_impl_const_rec(expr2t::const_op_delegate &f) const;
+  // Operand visitors; these are templates over the delegate and so are
+  // defined inline here rather than instantiated with the rest.
+  template <typename F>
+  void foreach_operand_rec(F &f) const
+  {
+    const derived *derived_this = static_cast<const derived *>(this);
+    visit_operand_field(derived_this->*membr_ptr::value, f);
+    superclass::foreach_operand_rec(f);
+  }
+
+  template <typename F>
+  void Foreach_operand_rec(F &f)
+  {
+    derived *derived_this = static_cast<derived *>(this);
+    visit_operand_field(derived_this->*membr_ptr::value, f);
+    superclass::Foreach_operand_rec(f);
+  }
 
   // Similar story, but for type2tc
-  void foreach_subtype_impl_rec(type2t::subtype_delegate &t);
-  void foreach_subtype_impl_const_rec(type2t::const_subtype_delegate &t) const;
+  template <typename F>
+  void foreach_subtype_rec(F &f) const
+  {
+    const derived *derived_this = static_cast<const derived *>(this);
+    visit_subtype_field(derived_this->*membr_ptr::value, f);
+    superclass::foreach_subtype_rec(f);
+  }
+
+  template <typename F>
+  void Foreach_subtype_rec(F &f)
+  {
+    derived *derived_this = static_cast<derived *>(this);
+    visit_subtype_field(derived_this->*membr_ptr::value, f);
+    superclass::Foreach_subtype_rec(f);
+  }
 };
 
 // Base instance of irep_methods2. This is a template specialization that
@@ -1192,8 +1353,9 @@ protected:
     return 0;
   }
 
-  void do_crc_rec() const
+  void do_crc_rec(size_t &crc) const
   {
+    (void)crc;
   }
 
   void hash_rec(crypto_hash &hash) const
@@ -1225,24 +1387,24 @@ protected:
     return 0;
   }
 
-  void foreach_operand_impl_rec(expr2t::op_delegate &f)
+  template <typename F>
+  void foreach_operand_rec(F &) const
   {
-    (void)f;
   }
 
-  void foreach_operand_impl_const_rec(expr2t::const_op_delegate &f) const
+  template <typename F>
+  void Foreach_operand_rec(F &)
   {
-    (void)f;
   }
 
-  void foreach_subtype_impl_rec(type2t::subtype_delegate &t)
+  template <typename F>
+  void foreach_subtype_rec(F &) const
   {
-    (void)t;
   }
 
-  void foreach_subtype_impl_const_rec(type2t::const_subtype_delegate &t) const
+  template <typename F>
+  void Foreach_subtype_rec(F &)
   {
-    (void)t;
   }
 };
 
@@ -1282,9 +1444,18 @@ public:
   expr2tc *get_sub_expr_nc(unsigned int i) override;
   unsigned int get_num_sub_exprs() const override;
 
-  void
-  foreach_operand_impl_const(expr2t::const_op_delegate &expr) const override;
-  void foreach_operand_impl(expr2t::op_delegate &expr) override;
+  // Statically dispatched operand iteration, see expr2t::foreach_operand
+  template <typename F>
+  void foreach_operand_static(F &f) const
+  {
+    superclass::foreach_operand_rec(f);
+  }
+
+  template <typename F>
+  void Foreach_operand_static(F &f)
+  {
+    superclass::Foreach_operand_rec(f);
+  }
 };
 
 /** Type methods template for type ireps.
@@ -1314,9 +1485,18 @@ public:
   {
   }
 
-  void
-  foreach_subtype_impl_const(type2t::const_subtype_delegate &t) const override;
-  void foreach_subtype_impl(type2t::subtype_delegate &t) override;
+  // Statically dispatched subtype iteration, see type2t::foreach_subtype
+  template <typename F>
+  void foreach_subtype_static(F &f) const
+  {
+    superclass::foreach_subtype_rec(f);
+  }
+
+  template <typename F>
+  void Foreach_subtype_static(F &f)
+  {
+    superclass::Foreach_subtype_rec(f);
+  }
 };
 
 // So that we can write such things as:
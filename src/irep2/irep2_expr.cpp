@@ -5,6 +5,7 @@
 #include <util/ieee_float.h>
 #include <irep2/irep2_type.h>
 #include <irep2/irep2_expr.h>
+#include <irep2/irep2_region.h>
 #include <irep2/irep2_utils.h>
 #include <util/migrate.h>
 #include <util/std_types.h>
@@ -122,18 +123,25 @@ static_assert(
 /*************************** Base expr2t definitions **************************/
 
 expr2t::expr2t(const type2tc &_type, expr_ids id)
-  : std::enable_shared_from_this<expr2t>(), expr_id(id), type(_type), crc_val(0)
+  : expr_id(id), type(_type)
 {
 }
 
 expr2t::expr2t(const expr2t &ref)
-  : std::enable_shared_from_this<expr2t>(),
-    expr_id(ref.expr_id),
-    type(ref.type),
-    crc_val(ref.crc_val)
+  : expr_id(ref.expr_id), type(ref.type), crc_val(ref.crc_val)
 {
 }
 
+void *expr2t::operator new(std::size_t size)
+{
+  return irep2_regiont::allocate(size);
+}
+
+void expr2t::operator delete(void *ptr, std::size_t size)
+{
+  irep2_regiont::deallocate(ptr, size);
+}
+
 bool expr2t::operator==(const expr2t &ref) const
 {
   if(!expr2t::cmp(ref))
@@ -228,9 +236,11 @@ size_t expr2t::crc() const
 
 size_t expr2t::do_crc() const
 {
-  boost::hash_combine(this->crc_val, type->do_crc());
-  boost::hash_combine(this->crc_val, (uint8_t)expr_id);
-  return this->crc_val;
+  size_t crc = this->crc_val.get();
+  boost::hash_combine(crc, type->do_crc());
+  boost::hash_combine(crc, (uint8_t)expr_id);
+  this->crc_val.set(crc);
+  return crc;
 }
 
 void expr2t::hash(crypto_hash &hash) const
@@ -243,7 +253,12 @@ void expr2t::hash(crypto_hash &hash) const
 
 std::string get_expr_id(const expr2t &expr)
 {
-  return std::string(expr_names[expr.expr_id]);
+  return get_expr_id(expr.expr_id);
+}
+
+std::string get_expr_id(expr2t::expr_ids id)
+{
+  return std::string(expr_names[id]);
 }
 
 std::string expr2t::pretty(unsigned int indent) const
@@ -1201,8 +1201,15 @@ public:
     expr2t::expr_ids id,
     const expr2tc &o,
     const expr2tc &offs,
-    unsigned int align)
-    : expr2t(t, id), object(o), offset(offs), alignment(align)
+    unsigned int align,
+    const BigInt &offs_min,
+    const BigInt &offs_max)
+    : expr2t(t, id),
+      object(o),
+      offset(offs),
+      alignment(align),
+      offset_min(offs_min),
+      offset_max(offs_max)
   {
   }
   object_desc_data(const object_desc_data &ref) = default;
@@ -1210,6 +1217,10 @@ public:
   expr2tc object;
   expr2tc offset;
   unsigned int alignment;
+  /** When offset isn't constant, the range it lies in, in bytes. Unknown
+   *  when offset_min is greater than offset_max. */
+  BigInt offset_min;
+  BigInt offset_max;
 
   // Type mangling:
   typedef esbmct::
@@ -1221,7 +1232,18 @@ public:
   typedef esbmct::
     field_traits<unsigned int, object_desc_data, &object_desc_data::alignment>
       alignment_field;
-  typedef esbmct::expr2t_traits<object_field, offset_field, alignment_field>
+  typedef esbmct::
+    field_traits<BigInt, object_desc_data, &object_desc_data::offset_min>
+      offset_min_field;
+  typedef esbmct::
+    field_traits<BigInt, object_desc_data, &object_desc_data::offset_max>
+      offset_max_field;
+  typedef esbmct::expr2t_traits<
+    object_field,
+    offset_field,
+    alignment_field,
+    offset_min_field,
+    offset_max_field>
     traits;
 };
 
@@ -3278,19 +3300,28 @@ public:
     const type2tc &t,
     const expr2tc &root,
     const expr2tc &offs,
-    unsigned int alignment)
+    unsigned int alignment,
+    const BigInt &offs_min = BigInt(0),
+    const BigInt &offs_max = BigInt(-1))
     : object_descriptor_expr_methods(
         t,
         object_descriptor_id,
         root,
         offs,
-        alignment)
+        alignment,
+        offs_min,
+        offs_max)
   {
   }
   object_descriptor2t(const object_descriptor2t &ref) = default;
 
   const expr2tc &get_root_object() const;
 
+  bool has_offset_bounds() const
+  {
+    return offset_min <= offset_max;
+  }
+
   static std::string field_names[esbmct::num_type_fields];
 };
 
@@ -3591,4 +3622,41 @@ BOOST_PP_LIST_FOR_EACH(_ESBMC_IREP2_MACROS_ENUM, foo, ESBMC_LIST_OF_EXPRS)
 #undef dynamic_cast
 #endif
 
+// Operand iteration, dispatched on expr_id to the concrete class so that the
+// walk over its fields and the delegate can be inlined together.
+#define _ESBMC_IREP2_VISIT_CONST(r, data, elem)                                \
+  case expr2t::BOOST_PP_CAT(elem, _id):                                        \
+    static_cast<const BOOST_PP_CAT(elem, 2t) *>(this)                          \
+      ->foreach_operand_static(t);                                             \
+    break;
+#define _ESBMC_IREP2_VISIT(r, data, elem)                                      \
+  case expr2t::BOOST_PP_CAT(elem, _id):                                        \
+    static_cast<BOOST_PP_CAT(elem, 2t) *>(this)->Foreach_operand_static(t);    \
+    break;
+
+template <typename T>
+void expr2t::foreach_operand(T &&t) const
+{
+  switch(expr_id)
+  {
+    BOOST_PP_LIST_FOR_EACH(_ESBMC_IREP2_VISIT_CONST, foo, ESBMC_LIST_OF_EXPRS)
+  default:
+    assert(0 && "Unrecognized expr id");
+  }
+}
+
+template <typename T>
+void expr2t::Foreach_operand(T &&t)
+{
+  switch(expr_id)
+  {
+    BOOST_PP_LIST_FOR_EACH(_ESBMC_IREP2_VISIT, foo, ESBMC_LIST_OF_EXPRS)
+  default:
+    assert(0 && "Unrecognized expr id");
+  }
+}
+
+#undef _ESBMC_IREP2_VISIT_CONST
+#undef _ESBMC_IREP2_VISIT
+
 #endif /* IREP2_EXPR_H_ */
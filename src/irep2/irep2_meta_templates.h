@@ -104,64 +104,6 @@ esbmct::expr_methods2<derived, baseclass, traits, container, enable, fields>::
   return superclass::get_num_sub_exprs_rec(); // Skips expr_id
 }
 
-template <
-  class derived,
-  class baseclass,
-  typename traits,
-  typename container,
-  typename enable,
-  typename fields>
-void esbmct::
-  expr_methods2<derived, baseclass, traits, container, enable, fields>::
-    foreach_operand_impl_const(expr2t::const_op_delegate &f) const
-{
-  superclass::foreach_operand_impl_const_rec(f);
-}
-
-template <
-  class derived,
-  class baseclass,
-  typename traits,
-  typename container,
-  typename enable,
-  typename fields>
-void esbmct::
-  expr_methods2<derived, baseclass, traits, container, enable, fields>::
-    foreach_operand_impl(expr2t::op_delegate &f)
-{
-  superclass::foreach_operand_impl_rec(f);
-}
-
-// Types
-
-template <
-  class derived,
-  class baseclass,
-  typename traits,
-  typename container,
-  typename enable,
-  typename fields>
-void esbmct::
-  type_methods2<derived, baseclass, traits, container, enable, fields>::
-    foreach_subtype_impl_const(type2t::const_subtype_delegate &f) const
-{
-  superclass::foreach_subtype_impl_const_rec(f);
-}
-
-template <
-  class derived,
-  class baseclass,
-  typename traits,
-  typename container,
-  typename enable,
-  typename fields>
-void esbmct::
-  type_methods2<derived, baseclass, traits, container, enable, fields>::
-    foreach_subtype_impl(type2t::subtype_delegate &f)
-{
-  superclass::foreach_subtype_impl_rec(f);
-}
-
 template <
   class derived,
   class baseclass,
@@ -174,13 +116,9 @@ auto esbmct::
     const -> base_container2tc
 {
   const derived *derived_this = static_cast<const derived *>(this);
-  // Use std::make_shared to clone this with one allocation, it puts the ref
-  // counting block ahead of the data object itself. This necessitates making
-  // a bare std::shared_ptr first, and then feeding that into an expr2tc
-  // container.
-  // Generally, storing an irep in a bare std::shared_ptr loses the detach
-  // facility and breaks everything, this is an exception.
-  return base_container2tc(std::make_shared<derived>(*derived_this));
+  // The reference count is part of the object, and starts again from zero in
+  // the copy.
+  return base_container2tc(new derived(*derived_this));
 }
 
 template <
@@ -239,17 +177,17 @@ size_t
 esbmct::irep_methods2<derived, baseclass, traits, container, enable, fields>::
   do_crc() const
 {
-  if(this->crc_val != 0)
-    return this->crc_val;
+  size_t crc = this->crc_val.get();
+  if(crc != 0)
+    return crc;
 
   // Starting from 0, pass a crc value through all the sub-fields of this
-  // expression. Store it into crc_val.
-  assert(this->crc_val == 0);
-
-  do_crc_rec(); // _includes_ type_id / expr_id
+  // expression. It is only stored into crc_val once complete, as other
+  // threads may read it meanwhile.
+  do_crc_rec(crc); // _includes_ type_id / expr_id
 
-  // Finally, combine the crc of this expr with the input , and return
-  return this->crc_val;
+  this->crc_val.set(crc);
+  return crc;
 }
 
 template <
@@ -355,15 +293,15 @@ template <
   typename fields>
 void esbmct::
   irep_methods2<derived, baseclass, traits, container, enable, fields>::
-    do_crc_rec() const
+    do_crc_rec(size_t &crc) const
 {
   const derived *derived_this = static_cast<const derived *>(this);
   auto m_ptr = membr_ptr::value;
 
   size_t tmp = do_type_crc(derived_this->*m_ptr);
-  boost::hash_combine(this->crc_val, tmp);
+  boost::hash_combine(crc, tmp);
 
-  superclass::do_crc_rec();
+  superclass::do_crc_rec(crc);
 }
 
 template <
@@ -447,47 +385,6 @@ esbmct::irep_methods2<derived, baseclass, traits, container, enable, fields>::
   return num + superclass::get_num_sub_exprs_rec();
 }
 
-// Operand iteration specialized for expr2tc: call delegate.
-template <
-  class derived,
-  class baseclass,
-  typename traits,
-  typename container,
-  typename enable,
-  typename fields>
-void esbmct::
-  irep_methods2<derived, baseclass, traits, container, enable, fields>::
-    foreach_operand_impl_const_rec(expr2t::const_op_delegate &f) const
-{
-  const derived *derived_this = static_cast<const derived *>(this);
-  auto m_ptr = membr_ptr::value;
-
-  // Call delegate
-  call_expr_delegate(derived_this->*m_ptr, f);
-
-  superclass::foreach_operand_impl_const_rec(f);
-}
-
-template <
-  class derived,
-  class baseclass,
-  typename traits,
-  typename container,
-  typename enable,
-  typename fields>
-void esbmct::
-  irep_methods2<derived, baseclass, traits, container, enable, fields>::
-    foreach_operand_impl_rec(expr2t::op_delegate &f)
-{
-  derived *derived_this = static_cast<derived *>(this);
-  auto m_ptr = membr_ptr::value;
-
-  // Call delegate
-  call_expr_delegate(derived_this->*m_ptr, f);
-
-  superclass::foreach_operand_impl_rec(f);
-}
-
 // Misery cakes to add readwrite modifier for non-const fields.
 namespace esbmct
 {
@@ -526,42 +423,3 @@ public:
 };
 } // namespace esbmct
 
-template <
-  class derived,
-  class baseclass,
-  typename traits,
-  typename container,
-  typename enable,
-  typename fields>
-void esbmct::
-  irep_methods2<derived, baseclass, traits, container, enable, fields>::
-    foreach_subtype_impl_const_rec(type2t::const_subtype_delegate &f) const
-{
-  const derived *derived_this = static_cast<const derived *>(this);
-  auto m_ptr = membr_ptr::value;
-
-  // Call delegate
-  call_type_delegate(derived_this->*m_ptr, f);
-
-  superclass::foreach_subtype_impl_const_rec(f);
-}
-
-template <
-  class derived,
-  class baseclass,
-  typename traits,
-  typename container,
-  typename enable,
-  typename fields>
-void esbmct::
-  irep_methods2<derived, baseclass, traits, container, enable, fields>::
-    foreach_subtype_impl_rec(type2t::subtype_delegate &f)
-{
-  derived *derived_this = static_cast<derived *>(this);
-  auto m_ptr = membr_ptr::value;
-
-  // Call delegate
-  call_type_delegate(derived_this->*m_ptr, f);
-
-  superclass::foreach_subtype_impl_rec(f);
-}
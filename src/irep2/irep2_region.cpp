@@ -0,0 +1,248 @@
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <irep2/irep2_expr.h>
+#include <irep2/irep2_region.h>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <util/irep_sharing.h>
+
+/* Chunks of all arenas that still exist, by address. A node doesn't record
+ * where it came from: chunks are aligned to their size, so the one holding a
+ * node is found by masking the node's address. While no arena exists, which
+ * is every run without --ssa-arena, freeing a node doesn't look at the table
+ * at all. */
+class chunk_tablet
+{
+public:
+  static chunk_tablet &get()
+  {
+    static chunk_tablet t;
+    return t;
+  }
+
+  bool empty() const
+  {
+    return size.load(std::memory_order_relaxed) == 0;
+  }
+
+  irep2_regiont::arenat *find(std::uintptr_t chunk) const
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex, std::defer_lock);
+    if(irep_sharingt::active())
+      lock.lock();
+
+    auto it = owners.find(chunk);
+    return it == owners.end() ? nullptr : it->second;
+  }
+
+  void insert(std::uintptr_t chunk, irep2_regiont::arenat *arena)
+  {
+    std::unique_lock<std::shared_timed_mutex> lock(mutex, std::defer_lock);
+    if(irep_sharingt::active())
+      lock.lock();
+
+    owners.emplace(chunk, arena);
+    size.store(owners.size(), std::memory_order_relaxed);
+  }
+
+  void erase(std::uintptr_t chunk)
+  {
+    std::unique_lock<std::shared_timed_mutex> lock(mutex, std::defer_lock);
+    if(irep_sharingt::active())
+      lock.lock();
+
+    owners.erase(chunk);
+    size.store(owners.size(), std::memory_order_relaxed);
+  }
+
+protected:
+  mutable std::shared_timed_mutex mutex;
+  std::unordered_map<std::uintptr_t, irep2_regiont::arenat *> owners;
+  std::atomic<std::size_t> size{0};
+};
+
+class irep2_regiont::arenat
+{
+public:
+  static const std::size_t chunk_size = 1 << 20;
+
+  // Blocks are rounded up so that nodes stay suitably aligned for anything
+  static const std::size_t align = alignof(std::max_align_t);
+
+  /** Size of the block holding a node of the given size */
+  static std::size_t block_size(std::size_t size)
+  {
+    return (size + align - 1) & ~(align - 1);
+  }
+
+  static std::uintptr_t chunk_of(const void *ptr)
+  {
+    return reinterpret_cast<std::uintptr_t>(ptr) &
+           ~static_cast<std::uintptr_t>(chunk_size - 1);
+  }
+
+  arenat() : owner(std::this_thread::get_id()), live(1)
+  {
+  }
+
+  /** A block of the given size, or nullptr if it doesn't fit in a chunk */
+  char *alloc(std::size_t size)
+  {
+    if(size > chunk_size)
+      return nullptr;
+
+    live.incr();
+
+    // Blocks of nodes released while the region is open are reused first
+    std::vector<char *> &blocks = free_blocks[size];
+    if(!blocks.empty())
+    {
+      char *res = blocks.back();
+      blocks.pop_back();
+      return res;
+    }
+
+    if(cur + size > end)
+    {
+      // Over-allocate so that the chunk can be aligned to its size
+      char *raw = static_cast<char *>(::operator new(2 * chunk_size));
+      chunks.push_back(raw);
+      cur = reinterpret_cast<char *>(chunk_of(raw + chunk_size - 1));
+      end = cur + chunk_size;
+      chunk_tablet::get().insert(chunk_of(cur), this);
+    }
+
+    char *res = cur;
+    cur += size;
+    return res;
+  }
+
+  void free(char *block, std::size_t size)
+  {
+    // Only the thread that allocates from the arena touches its free lists,
+    // nodes released anywhere else merely drop their reference
+    if(std::this_thread::get_id() == owner && open)
+      free_blocks[size].push_back(block);
+    release();
+  }
+
+  void close()
+  {
+    open = false;
+    free_blocks.clear();
+    release();
+  }
+
+  ~arenat()
+  {
+    // All chunks go at once, whatever the number of nodes they held
+    for(char *raw : chunks)
+    {
+      chunk_tablet::get().erase(chunk_of(raw + chunk_size - 1));
+      ::operator delete(raw);
+    }
+  }
+
+protected:
+  void release()
+  {
+    if(live.decr())
+      delete this;
+  }
+
+  const std::thread::id owner;
+  bool open = true;
+  char *cur = nullptr;
+  char *end = nullptr;
+  // As allocated, before alignment
+  std::vector<char *> chunks;
+  // Free blocks by size
+  std::unordered_map<std::size_t, std::vector<char *>> free_blocks;
+  // The open region holds one reference, every node allocated one more
+  irep_refcountt live;
+};
+
+thread_local irep2_regiont::arenat *irep2_regiont::current = nullptr;
+
+irep2_regiont::irep2_regiont() : arena(new arenat()), prev(current)
+{
+  current = arena;
+}
+
+irep2_regiont::~irep2_regiont()
+{
+  assert(current == arena && "irep2 regions must be closed in LIFO order");
+  current = prev;
+  arena->close();
+}
+
+void *irep2_regiont::allocate(std::size_t size)
+{
+  char *block = nullptr;
+  if(current != nullptr)
+    block = current->alloc(arenat::block_size(size));
+  return block != nullptr ? block : ::operator new(size);
+}
+
+void irep2_regiont::deallocate(void *ptr, std::size_t size)
+{
+  arenat *a = chunk_tablet::get().empty()
+                ? nullptr
+                : chunk_tablet::get().find(arenat::chunk_of(ptr));
+  if(a == nullptr)
+    ::operator delete(ptr);
+  else
+    a->free(static_cast<char *>(ptr), arenat::block_size(size));
+}
+
+bool irep2_regiont::in_region(const void *ptr)
+{
+  return !chunk_tablet::get().empty() &&
+         chunk_tablet::get().find(arenat::chunk_of(ptr)) != nullptr;
+}
+
+typedef std::unordered_map<const expr2t *, expr2tc> copy_cachet;
+
+static expr2tc copy_out_rec(const expr2tc &expr, copy_cachet &cache)
+{
+  if(is_nil_expr(expr))
+    return expr;
+
+  auto it = cache.find(expr.get());
+  if(it != cache.end())
+    return it->second;
+
+  std::vector<expr2tc> ops;
+  bool changed = false;
+  expr->foreach_operand([&ops, &changed, &cache](const expr2tc &e) {
+    ops.push_back(copy_out_rec(e, cache));
+    changed |= ops.back().get() != e.get();
+  });
+
+  expr2tc res = expr;
+  if(changed || irep2_regiont::in_region(expr.get()))
+  {
+    res = expr->clone();
+    auto op = ops.begin();
+    res.get()->Foreach_operand([&op](expr2tc &e) { e = *op++; });
+  }
+
+  cache.emplace(expr.get(), res);
+  return res;
+}
+
+expr2tc irep2_regiont::copy_out(const expr2tc &expr)
+{
+  // Nothing created while copying may end up in a region
+  arenat *saved = current;
+  current = nullptr;
+
+  copy_cachet cache;
+  expr2tc res = copy_out_rec(expr, cache);
+
+  current = saved;
+  return res;
+}
@@ -0,0 +1,61 @@
+#ifndef IREP2_REGION_H_
+#define IREP2_REGION_H_
+
+#include <cstddef>
+#include <irep2/irep2.h>
+
+/** Allocation region for expr2t nodes.
+ *  While an irep2_regiont is alive (and the innermost one on its thread),
+ *  every expr2t that the thread creates is allocated from the region's arena
+ *  instead of going through the general purpose allocator: from a free list
+ *  of blocks of its size if one is available, otherwise by bumping a pointer
+ *  into the current chunk. Nodes carry no trace of where they came from, the
+ *  arena owning a node is found from the address of its chunk; outside of
+ *  regions nodes cost exactly what they would without them. Nodes freed while
+ *  the region is open go back to the free lists; the chunks backing the arena
+ *  are freed in one go once the region has been closed and the last of its
+ *  nodes has gone.
+ *
+ *  This is meant for phases such as a single symex run, that create huge
+ *  numbers of short lived expressions and drop them all at once: teardown no
+ *  longer pays for one free() per node, and the equation of one run doesn't
+ *  fragment the heap for the next one. Nodes that outlive the region (for
+ *  example those stored in the goto program or a cache) are never dangling,
+ *  they merely keep their arena's memory around until they are released too.
+ *  Anything expected to live long should therefore be created outside the
+ *  region, or be copied out of it with copy_out().
+ *
+ *  Regions nest, and each thread has its own innermost region. Nodes may be
+ *  freed from other threads under the rules of irep_sharingt, but only the
+ *  thread that opened a region allocates from it or recycles its blocks. */
+class irep2_regiont
+{
+public:
+  irep2_regiont();
+  ~irep2_regiont();
+
+  irep2_regiont(const irep2_regiont &) = delete;
+  irep2_regiont &operator=(const irep2_regiont &) = delete;
+
+  /** Called by expr2t::operator new/delete */
+  static void *allocate(std::size_t size);
+  static void deallocate(void *ptr, std::size_t size);
+
+  /** Whether this node, allocated by allocate(), came from some region */
+  static bool in_region(const void *ptr);
+
+  /** Deep copy of expr in which no node lives in a region, sharing whatever
+   *  parts of it already don't. */
+  static expr2tc copy_out(const expr2tc &expr);
+
+protected:
+  class arenat;
+  friend class chunk_tablet;
+
+  arenat *arena;
+  arenat *prev;
+
+  static thread_local arenat *current;
+};
+
+#endif /* IREP2_REGION_H_ */
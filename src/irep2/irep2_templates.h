@@ -96,58 +96,3 @@ unsigned int do_count_sub_exprs<const expr2tc>(const expr2tc &);
 template <>
 unsigned int do_count_sub_exprs<const std::vector<expr2tc>>(
   const std::vector<expr2tc> &item);
-
-// Local template for implementing delegate calling, with type dependency.
-// Can't easily extend to cover types because field type is _already_ abstracted
-template <typename T, typename U>
-void call_expr_delegate(T &, U &)
-{
-}
-
-template <>
-void call_expr_delegate<const expr2tc, expr2t::const_op_delegate>(
-  const expr2tc &ref,
-  expr2t::const_op_delegate &f);
-
-template <>
-void call_expr_delegate<expr2tc, expr2t::op_delegate>(
-  expr2tc &ref,
-  expr2t::op_delegate &f);
-
-template <>
-void call_expr_delegate<const std::vector<expr2tc>, expr2t::const_op_delegate>(
-  const std::vector<expr2tc> &ref,
-  expr2t::const_op_delegate &f);
-
-template <>
-void call_expr_delegate<std::vector<expr2tc>, expr2t::op_delegate>(
-  std::vector<expr2tc> &ref,
-  expr2t::op_delegate &f);
-
-// Repeat of call_expr_delegate, but for types
-template <typename T, typename U>
-void call_type_delegate(T &, U &)
-{
-}
-
-template <>
-void call_type_delegate<const type2tc, type2t::const_subtype_delegate>(
-  const type2tc &ref,
-  type2t::const_subtype_delegate &f);
-
-template <>
-void call_type_delegate<type2tc, type2t::subtype_delegate>(
-  type2tc &ref,
-  type2t::subtype_delegate &f);
-
-template <>
-void call_type_delegate<
-  const std::vector<type2tc>,
-  type2t::const_subtype_delegate>(
-  const std::vector<type2tc> &ref,
-  type2t::const_subtype_delegate &f);
-
-template <>
-void call_type_delegate<std::vector<type2tc>, type2t::subtype_delegate>(
-  std::vector<type2tc> &ref,
-  type2t::subtype_delegate &f);
\ No newline at end of file
@@ -46,8 +46,7 @@ std::string get_type_id(const type2t &type)
   return std::string(type_names[type.type_id]);
 }
 
-type2t::type2t(type_ids id)
-  : std::enable_shared_from_this<type2t>(), type_id(id), crc_val(0)
+type2t::type2t(type_ids id) : type_id(id)
 {
 }
 
@@ -116,8 +115,10 @@ size_t type2t::crc() const
 
 size_t type2t::do_crc() const
 {
-  boost::hash_combine(this->crc_val, (uint8_t)type_id);
-  return this->crc_val;
+  size_t crc = this->crc_val.get();
+  boost::hash_combine(crc, (uint8_t)type_id);
+  this->crc_val.set(crc);
+  return crc;
 }
 
 void type2t::hash(crypto_hash &hash) const
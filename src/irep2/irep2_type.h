@@ -741,4 +741,51 @@ type_macros(cpp_name);
 #undef dynamic_cast
 #endif
 
+// Subtype iteration, dispatched on type_id to the concrete class so that the
+// walk over its fields and the delegate can be inlined together.
+#define type_visit_cases(method, qual)                                         \
+  type_visit_case(bool, method, qual);                                         \
+  type_visit_case(empty, method, qual);                                        \
+  type_visit_case(symbol, method, qual);                                       \
+  type_visit_case(struct, method, qual);                                       \
+  type_visit_case(union, method, qual);                                        \
+  type_visit_case(code, method, qual);                                         \
+  type_visit_case(array, method, qual);                                        \
+  type_visit_case(pointer, method, qual);                                      \
+  type_visit_case(unsignedbv, method, qual);                                   \
+  type_visit_case(signedbv, method, qual);                                     \
+  type_visit_case(fixedbv, method, qual);                                      \
+  type_visit_case(floatbv, method, qual);                                      \
+  type_visit_case(string, method, qual);                                       \
+  type_visit_case(cpp_name, method, qual)
+#define type_visit_case(name, method, qual)                                    \
+  case type2t::name##_id:                                                      \
+    static_cast<qual name##_type2t *>(this)->method(t);                        \
+    break
+
+template <typename T>
+void type2t::foreach_subtype(T &&t) const
+{
+  switch(type_id)
+  {
+    type_visit_cases(foreach_subtype_static, const);
+  default:
+    assert(0 && "Unrecognized type id");
+  }
+}
+
+template <typename T>
+void type2t::Foreach_subtype(T &&t)
+{
+  switch(type_id)
+  {
+    type_visit_cases(Foreach_subtype_static, );
+  default:
+    assert(0 && "Unrecognized type id");
+  }
+}
+
+#undef type_visit_case
+#undef type_visit_cases
+
 #endif /* IREP2_TYPE_H_ */
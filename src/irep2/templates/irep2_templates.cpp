@@ -199,7 +199,7 @@ std::string code_free2t::field_names[esbmct::num_type_fields] =
 std::string code_goto2t::field_names[esbmct::num_type_fields] =
   {"target", "", "", "", ""};
 std::string object_descriptor2t::field_names[esbmct::num_type_fields] =
-  {"object", "offset", "alignment", "", ""};
+  {"object", "offset", "alignment", "offset_min", "offset_max"};
 std::string code_function_call2t::field_names[esbmct::num_type_fields] =
   {"return_sym", "function", "operands", "", ""};
 std::string code_comma2t::field_names[esbmct::num_type_fields] =
@@ -354,73 +354,3 @@ do_count_sub_exprs<const std::vector<expr2tc>>(const std::vector<expr2tc> &item)
 {
   return item.size();
 }
-
-template <>
-void call_expr_delegate<const expr2tc, expr2t::const_op_delegate>(
-  const expr2tc &ref,
-  expr2t::const_op_delegate &f)
-{
-  f(ref);
-}
-
-template <>
-void call_expr_delegate<expr2tc, expr2t::op_delegate>(
-  expr2tc &ref,
-  expr2t::op_delegate &f)
-{
-  f(ref);
-}
-
-template <>
-void call_expr_delegate<const std::vector<expr2tc>, expr2t::const_op_delegate>(
-  const std::vector<expr2tc> &ref,
-  expr2t::const_op_delegate &f)
-{
-  for(const expr2tc &r : ref)
-    f(r);
-}
-
-template <>
-void call_expr_delegate<std::vector<expr2tc>, expr2t::op_delegate>(
-  std::vector<expr2tc> &ref,
-  expr2t::op_delegate &f)
-{
-  for(expr2tc &r : ref)
-    f(r);
-}
-
-template <>
-void call_type_delegate<const type2tc, type2t::const_subtype_delegate>(
-  const type2tc &ref,
-  type2t::const_subtype_delegate &f)
-{
-  f(ref);
-}
-
-template <>
-void call_type_delegate<type2tc, type2t::subtype_delegate>(
-  type2tc &ref,
-  type2t::subtype_delegate &f)
-{
-  f(ref);
-}
-
-template <>
-void call_type_delegate<
-  const std::vector<type2tc>,
-  type2t::const_subtype_delegate>(
-  const std::vector<type2tc> &ref,
-  type2t::const_subtype_delegate &f)
-{
-  for(const type2tc &r : ref)
-    f(r);
-}
-
-template <>
-void call_type_delegate<std::vector<type2tc>, type2t::subtype_delegate>(
-  std::vector<type2tc> &ref,
-  type2t::subtype_delegate &f)
-{
-  for(type2tc &r : ref)
-    f(r);
-}
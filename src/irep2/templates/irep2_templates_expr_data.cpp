@@ -41,7 +41,7 @@ expr_typedefs1(code_return, code_expression_data);
 expr_typedefs_empty(code_skip, expr2t);
 expr_typedefs1(code_free, code_expression_data);
 expr_typedefs1(code_goto, code_goto_data);
-expr_typedefs3(object_descriptor, object_desc_data);
+expr_typedefs5(object_descriptor, object_desc_data);
 expr_typedefs3(code_function_call, code_funccall_data);
 expr_typedefs2(code_comma, code_comma_data);
 expr_typedefs1(code_asm, code_asm_data);
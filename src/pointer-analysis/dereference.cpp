@@ -72,6 +72,27 @@ static inline expr2tc get_base_dereference(const expr2tc &e)
   }
 }
 
+/* If every offset in [offset_min, offset_max] lies in the same element of
+ * size elem_size, return true and set idx to that element's index. The range
+ * is then narrowed to offsets within the element. */
+static bool single_element(
+  BigInt &offset_min,
+  BigInt &offset_max,
+  const BigInt &elem_size,
+  BigInt &idx)
+{
+  if(offset_min > offset_max || offset_min < 0 || elem_size == 0)
+    return false;
+
+  idx = offset_min / elem_size;
+  if(offset_max / elem_size != idx)
+    return false;
+
+  offset_min -= idx * elem_size;
+  offset_max -= idx * elem_size;
+  return true;
+}
+
 static inline expr2tc replace_dyn_offset_with_zero(const expr2tc &e)
 {
   // Knowing the offset value is important when we try to
@@ -713,6 +734,7 @@ expr2tc dereferencet::build_reference_to(
   // If offset is unknown, or whatever, we have to consider it
   // nondeterministic, and let the reference builders deal with it.
   unsigned int alignment = o.alignment;
+  bool bounded = false;
   if(!is_constant_int2t(final_offset))
   {
     assert(alignment != 0);
@@ -724,7 +746,16 @@ expr2tc dereferencet::build_reference_to(
       // it as future work.
       alignment = 1;
     }
-    final_offset = pointer_offset2tc(pointer_type2(), deref_expr);
+    else if(o.has_offset_bounds())
+    {
+      // The value set knows the range the offset of this symbol lies in
+      bounded = true;
+    }
+
+    if(bounded && o.offset_min == o.offset_max)
+      final_offset = constant_int2tc(pointer_type2(), o.offset_min);
+    else
+      final_offset = pointer_offset2tc(pointer_type2(), deref_expr);
   }
 
   // Converting final_offset from bytes to bits!
@@ -770,9 +801,30 @@ expr2tc dereferencet::build_reference_to(
   // Converting alignment to bits here
   alignment *= 8;
 
+  // Range of the offset in bits, if the value set knows it
+  BigInt offset_min = 0, offset_max = -1;
+  if(
+    bounded && !is_constant_int2t(final_offset) &&
+    (is_nil_expr(lexical_offset) || is_constant_int2t(lexical_offset)))
+  {
+    BigInt lex = is_nil_expr(lexical_offset)
+                   ? BigInt(0)
+                   : to_constant_int2t(lexical_offset).value;
+    offset_min = o.offset_min * 8 + lex;
+    offset_max = o.offset_max * 8 + lex;
+  }
+
   // Call reference building methods. For the given data object in value,
   // an expression of type type will be constructed that reads from it.
-  build_reference_rec(value, final_offset, type, tmp_guard, mode, alignment);
+  build_reference_rec(
+    value,
+    final_offset,
+    type,
+    tmp_guard,
+    mode,
+    alignment,
+    offset_min,
+    offset_max);
 
   return value;
 }
@@ -841,8 +893,18 @@ void dereferencet::build_reference_rec(
   const type2tc &type,
   const guardt &guard,
   modet mode,
-  unsigned long alignment)
+  unsigned long alignment,
+  const BigInt &offset_min,
+  const BigInt &offset_max)
 {
+  // A nondeterministic offset that can only take one value is a constant one
+  if(!is_constant_int2t(offset) && offset_min == offset_max)
+  {
+    expr2tc offs = constant_int2tc(offset->type, offset_min);
+    build_reference_rec(value, offs, type, guard, mode, alignment);
+    return;
+  }
+
   int flags = 0;
   if(is_constant_int2t(offset))
     flags |= flag_is_const_offs;
@@ -941,16 +1003,17 @@ void dereferencet::build_reference_rec(
 
   case flag_src_scalar | flag_dst_scalar | flag_is_dyn_offs:
     // Access a scalar within a scalar (dyn offset)
-    construct_from_dyn_offset(value, offset, type);
+    construct_from_dyn_offset(value, offset, type, offset_min, offset_max);
     break;
   case flag_src_struct | flag_dst_scalar | flag_is_dyn_offs:
     // Extract a scalar from within a structure (dyn offset)
     construct_from_dyn_struct_offset(
-      value, offset, type, guard, alignment, mode);
+      value, offset, type, guard, alignment, mode, offset_min, offset_max);
     break;
   case flag_src_array | flag_dst_scalar | flag_is_dyn_offs:
     // Extract a scalar from within an array (dyn offset)
-    construct_from_array(value, offset, type, guard, mode, alignment);
+    construct_from_array(
+      value, offset, type, guard, mode, alignment, offset_min, offset_max);
     break;
 
   case flag_src_scalar | flag_dst_struct | flag_is_dyn_offs:
@@ -1014,7 +1077,9 @@ void dereferencet::construct_from_array(
   const type2tc &type,
   const guardt &guard,
   modet mode,
-  unsigned long alignment)
+  unsigned long alignment,
+  const BigInt &offset_min,
+  const BigInt &offset_max)
 {
   assert(is_array_type(value) || is_string_type(value));
 
@@ -1023,7 +1088,8 @@ void dereferencet::construct_from_array(
 
   if(is_array_type(arr_subtype))
   {
-    construct_from_multidir_array(value, offset, type, guard, alignment, mode);
+    construct_from_multidir_array(
+      value, offset, type, guard, alignment, mode, offset_min, offset_max);
     return;
   }
 
@@ -1037,10 +1103,23 @@ void dereferencet::construct_from_array(
   modulus2tc mod(offset->type, offset, subtype_sz_expr);
   simplify(mod);
 
+  // When the value set confines the offset to a single element, select that
+  // element directly rather than with a symbolic index.
+  expr2tc index = div;
+  BigInt elem_min = offset_min, elem_max = offset_max, idx;
+  if(single_element(elem_min, elem_max, BigInt(subtype_size), idx))
+    index = constant_int2tc(div->type, idx);
+  else
+  {
+    elem_min = 0;
+    elem_max = -1;
+  }
+
   if(is_structure_type(arr_subtype))
   {
-    value = index2tc(arr_subtype, value, div);
-    build_reference_rec(value, mod, type, guard, mode, alignment);
+    value = index2tc(arr_subtype, value, index);
+    build_reference_rec(
+      value, mod, type, guard, mode, alignment, elem_min, elem_max);
     return;
   }
 
@@ -1078,8 +1157,9 @@ void dereferencet::construct_from_array(
   {
     // Just extract an element and apply other standard extraction stuff.
     // No scope for stitching being required.
-    value = index2tc(arr_subtype, value, div);
-    build_reference_rec(value, mod, type, guard, mode, alignment);
+    value = index2tc(arr_subtype, value, index);
+    build_reference_rec(
+      value, mod, type, guard, mode, alignment, elem_min, elem_max);
   }
   else
   {
@@ -1183,13 +1263,16 @@ void dereferencet::construct_from_const_struct_offset(
   const struct_type2t &struct_type = to_struct_type(value->type);
   const BigInt int_offset = to_constant_int2t(offset).value;
   BigInt access_size = type_byte_size_bits(type);
+  const type_layoutt &layout = type_layout(value->type);
 
-  unsigned int i = 0;
-  for(auto const &it : struct_type.members)
+  // Members that end before the offset can't be accessed, skip them
+  for(unsigned int i = layout.member_at(int_offset);
+      i < struct_type.members.size();
+      i++)
   {
-    BigInt m_offs =
-      member_offset_bits(value->type, struct_type.member_names[i]);
-    BigInt m_size = type_byte_size_bits(it);
+    const type2tc &it = struct_type.members[i];
+    const BigInt &m_offs = layout.offsets[i];
+    const BigInt &m_size = layout.sizes[i];
 
     if(m_size == 0)
     {
@@ -1202,7 +1285,6 @@ void dereferencet::construct_from_const_struct_offset(
       // should have been called (construct_struct_ref_from_const_offset).
       assert(is_struct_type(it));
       assert(!is_struct_type(type));
-      i++;
       continue;
     }
 
@@ -1273,7 +1355,6 @@ void dereferencet::construct_from_const_struct_offset(
     }
 
     // Wasn't that field.
-    i++;
   }
 
   // Fell out of that struct -- means we've accessed out of bounds. Code at
@@ -1288,6 +1369,8 @@ void dereferencet::construct_from_dyn_struct_offset(
   const guardt &guard,
   unsigned long alignment,
   modet mode,
+  const BigInt &offset_min,
+  const BigInt &offset_max,
   const expr2tc *failed_symbol)
 {
   // if we are accessing the struct using a byte, we can ignore alignment
@@ -1296,7 +1379,8 @@ void dereferencet::construct_from_dyn_struct_offset(
   if(type->get_width() == 8)
   {
     value = bitcast2tc(get_uint_type(value->type->get_width()), value);
-    return construct_from_dyn_offset(value, offset, type);
+    return construct_from_dyn_offset(
+      value, offset, type, offset_min, offset_max);
   }
 
   // For each element of the struct, look at the alignment, and produce an
@@ -1316,13 +1400,25 @@ void dereferencet::construct_from_dyn_struct_offset(
   // if-then-else chain based on those guards.
   std::list<std::pair<expr2tc, expr2tc>> extract_list;
 
+  const type_layoutt &layout = type_layout(value->type);
   unsigned int i = 0;
   for(auto const &it : struct_type.members)
   {
-    BigInt offs = member_offset_bits(value->type, struct_type.member_names[i]);
+    const BigInt &offs = layout.offsets[i];
 
     // Compute some kind of guard
-    BigInt field_size = type_byte_size_bits(it);
+    const BigInt &field_size = layout.sizes[i];
+
+    // Fields the pointer can't point into don't need a case at all; should
+    // the offset be outside of the range anyway, we fall through to the
+    // failed symbol like any out of bounds access.
+    if(
+      offset_min <= offset_max &&
+      (offs + field_size <= offset_min || offs > offset_max))
+    {
+      i++;
+      continue;
+    }
 
     // Round up to word size
     expr2tc field_offset = constant_int2tc(offset->type, offs);
@@ -1334,16 +1430,36 @@ void dereferencet::construct_from_dyn_struct_offset(
     expr2tc new_offset = sub2tc(offset->type, offset, field_offset);
     simplify(new_offset);
 
+    // Range of the offset into this field. The field is only read under
+    // field_guard, so the range may be clipped to the field.
+    BigInt field_min = 0, field_max = -1;
+    if(offset_min <= offset_max)
+    {
+      field_min = (offset_min > offs ? offset_min : offs) - offs;
+      field_max = (offset_max < offs + field_size ? offset_max
+                                                  : offs + field_size - 1) -
+                  offs;
+    }
+
     if(is_struct_type(it))
     {
       // Handle recursive structs
       construct_from_dyn_struct_offset(
-        field, new_offset, type, guard, alignment, mode, &failed_container);
+        field,
+        new_offset,
+        type,
+        guard,
+        alignment,
+        mode,
+        field_min,
+        field_max,
+        &failed_container);
       extract_list.emplace_back(field_guard, field);
     }
     else if(is_array_type(it) || is_union_type(it))
     {
-      construct_from_array(field, new_offset, type, guard, mode, alignment);
+      construct_from_array(
+        field, new_offset, type, guard, mode, alignment, field_min, field_max);
       extract_list.emplace_back(field_guard, field);
     }
     else if((access_sz > it->get_width()) && (type->get_width() != 8))
@@ -1368,7 +1484,8 @@ void dereferencet::construct_from_dyn_struct_offset(
     else
     {
       // Try to resolve this recursively
-      build_reference_rec(field, new_offset, type, guard, mode, alignment);
+      build_reference_rec(
+        field, new_offset, type, guard, mode, alignment, field_min, field_max);
       extract_list.emplace_back(field_guard, field);
     }
 
@@ -1392,7 +1509,9 @@ void dereferencet::construct_from_dyn_struct_offset(
 void dereferencet::construct_from_dyn_offset(
   expr2tc &value,
   const expr2tc &offset,
-  const type2tc &type)
+  const type2tc &type,
+  const BigInt &offset_min,
+  const BigInt &offset_max)
 {
   expr2tc orig_value = value;
 
@@ -1404,11 +1523,17 @@ void dereferencet::construct_from_dyn_offset(
   // with offset == 0, or is out of bounds and should be a free value.
   if(base_type_eq(value->type, type, ns))
   {
-    // Is offset zero?
-    equality2tc eq(offset, gen_zero(offset->type));
-
     // Yes -> value, no -> free value
     expr2tc free_result = make_failed_symbol(type);
+    if(offset_min <= offset_max && (offset_min > 0 || offset_max < 0))
+    {
+      // The value set says the offset can't be zero
+      value = free_result;
+      return;
+    }
+
+    // Is offset zero?
+    equality2tc eq(offset, gen_zero(offset->type));
     if2tc result(type, eq, value, free_result);
 
     value = result;
@@ -1443,7 +1568,9 @@ void dereferencet::construct_from_multidir_array(
   const type2tc &type,
   const guardt &guard,
   unsigned long alignment,
-  modet mode)
+  modet mode,
+  const BigInt &offset_min,
+  const BigInt &offset_max)
 {
   assert(is_array_type(value) || is_string_type(value));
   const array_type2t arr_type = get_arr_type(value);
@@ -1457,13 +1584,26 @@ void dereferencet::construct_from_multidir_array(
   div2tc div(pointer_type2(), offset, subtype_sz_expr);
   simplify(div);
 
-  index2tc outer_idx(arr_type.subtype, value, div);
+  // As in construct_from_array, use a constant index should the offset range
+  // lie within one row
+  expr2tc index = div;
+  BigInt elem_min = offset_min, elem_max = offset_max, idx;
+  if(single_element(elem_min, elem_max, subtype_sz, idx))
+    index = constant_int2tc(pointer_type2(), idx);
+  else
+  {
+    elem_min = 0;
+    elem_max = -1;
+  }
+
+  index2tc outer_idx(arr_type.subtype, value, index);
   value = outer_idx;
 
   modulus2tc mod(pointer_type2(), offset, subtype_sz_expr);
   simplify(mod);
 
-  build_reference_rec(value, mod, type, guard, mode, alignment);
+  build_reference_rec(
+    value, mod, type, guard, mode, alignment, elem_min, elem_max);
 }
 
 void dereferencet::construct_struct_ref_from_const_offset_array(
@@ -1549,11 +1689,12 @@ void dereferencet::construct_struct_ref_from_const_offset(
     // crazy inside structs.
 
     auto *data = static_cast<const struct_union_data *>(value->type.get());
+    const type_layoutt &layout = type_layout(value->type);
     unsigned int i = 0;
     for(auto const &it : data->members)
     {
-      BigInt offs = member_offset_bits(value->type, data->member_names[i]);
-      BigInt size = type_byte_size_bits(it);
+      const BigInt &offs = layout.offsets[i];
+      const BigInt &size = layout.sizes[i];
 
       if(
         !is_scalar_type(it) && intref.value >= offs &&
@@ -1716,6 +1857,7 @@ void dereferencet::construct_struct_ref_from_dyn_offs_rec(
 
     // It's not compatible, but a subtype may be. Iterate over all of them.
     const struct_type2t &struct_type = to_struct_type(value->type);
+    const type_layoutt &layout = type_layout(value->type);
     unsigned int i = 0;
     for(auto const &it : struct_type.members)
     {
@@ -1726,9 +1868,8 @@ void dereferencet::construct_struct_ref_from_dyn_offs_rec(
         continue;
       }
 
-      BigInt memb_offs =
-        member_offset_bits(value->type, struct_type.member_names[i]);
-      BigInt size = type_byte_size_bits(it);
+      const BigInt &memb_offs = layout.offsets[i];
+      const BigInt &size = layout.sizes[i];
       expr2tc memb_offs_expr = gen_ulong(memb_offs.to_uint64());
       expr2tc limit_expr = gen_ulong(memb_offs.to_uint64() + size.to_uint64());
       expr2tc memb = member2tc(it, value, struct_type.member_names[i]);
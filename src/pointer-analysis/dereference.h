@@ -426,13 +426,18 @@ private:
     unsigned long num_bits);
 
 public:
+  /** offset_min and offset_max are the range, in bits, that a
+   *  nondeterministic offset is known to lie in, as tracked by the value set.
+   *  The range is empty (min > max) when nothing is known. */
   void build_reference_rec(
     expr2tc &value,
     const expr2tc &offset,
     const type2tc &type,
     const guardt &guard,
     modet mode,
-    unsigned long alignment = 0);
+    unsigned long alignment = 0,
+    const BigInt &offset_min = BigInt(0),
+    const BigInt &offset_max = BigInt(-1));
 
 private:
   void construct_from_const_offset(
@@ -442,7 +447,9 @@ private:
   void construct_from_dyn_offset(
     expr2tc &value,
     const expr2tc &offset,
-    const type2tc &type);
+    const type2tc &type,
+    const BigInt &offset_min = BigInt(0),
+    const BigInt &offset_max = BigInt(-1));
   void construct_from_const_struct_offset(
     expr2tc &value,
     const expr2tc &offset,
@@ -456,6 +463,8 @@ private:
     const guardt &guard,
     unsigned long alignment,
     modet mode,
+    const BigInt &offset_min,
+    const BigInt &offset_max,
     const expr2tc *failed_symbol = nullptr);
   void construct_from_multidir_array(
     expr2tc &value,
@@ -463,7 +472,9 @@ private:
     const type2tc &type,
     const guardt &guard,
     unsigned long alignment,
-    modet mode);
+    modet mode,
+    const BigInt &offset_min = BigInt(0),
+    const BigInt &offset_max = BigInt(-1));
   void construct_struct_ref_from_const_offset_array(
     expr2tc &value,
     const expr2tc &offs,
@@ -495,7 +506,9 @@ private:
     const type2tc &type,
     const guardt &guard,
     modet mode,
-    unsigned long alignment = 0);
+    unsigned long alignment = 0,
+    const BigInt &offset_min = BigInt(0),
+    const BigInt &offset_max = BigInt(-1));
 
 public:
   void set_block_assertions(void)
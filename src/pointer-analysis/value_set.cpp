@@ -85,6 +85,10 @@ void value_sett::output(std::ostream &out) const
 
         if(o_it->second.offset_is_set)
           result += integer2string(o_it->second.offset) + "";
+        else if(o_it->second.offset_bounded)
+          result += integer2string(o_it->second.offset_min) + ".." +
+                    integer2string(o_it->second.offset_max) + "/" +
+                    std::to_string(o_it->second.offset_alignment);
         else
           result += "*";
 
@@ -127,6 +131,15 @@ expr2tc value_sett::to_expr(object_mapt::const_iterator it) const
   else
     offs = unknown2tc(index_type2());
 
+  if(!it->second.offset_is_set && it->second.offset_bounded)
+    return object_descriptor2tc(
+      object->type,
+      object,
+      offs,
+      it->second.offset_alignment,
+      it->second.offset_min,
+      it->second.offset_max);
+
   expr2tc obj = object_descriptor2tc(
     object->type, object, offs, it->second.offset_alignment);
   return obj;
@@ -672,9 +685,12 @@ void value_sett::get_value_set_rec(
         else if(is_const && !object.offset_is_set)
         {
           // Offset is const, but existing pointer isn't. The alignment is now
-          // at least as small as the operand alignment.
+          // at least as small as the operand alignment, and any bounds move
+          // along with the pointer.
           object.offset_alignment =
             std::min(nat_align, object.offset_alignment);
+          object.offset_min += total_offs;
+          object.offset_max += total_offs;
         }
         else if(!is_const && object.offset_is_set)
         {
@@ -699,6 +715,7 @@ void value_sett::get_value_set_rec(
           }
 
           object.offset_is_set = false;
+          object.offset_bounded = false;
           object.offset_alignment = std::min(nat_align, offset_align);
         }
         else
@@ -707,6 +724,7 @@ void value_sett::get_value_set_rec(
           // the current object. So, just take the minimum available.
           object.offset_alignment =
             std::min(nat_align, object.offset_alignment);
+          object.offset_bounded = false;
         }
 
         // Once updated, store object reference into destination map.
@@ -848,9 +866,9 @@ void value_sett::get_reference_set_rec(const expr2tc &expr, object_mapt &dest)
         {
           ;
         }
-        else if(has_const_index_offset && o.offset_is_zero())
+        else if(has_const_index_offset && o.offset_is_set)
         {
-          o.offset = index_offset;
+          o.offset += index_offset;
         }
         else
         {
@@ -870,6 +888,15 @@ void value_sett::get_reference_set_rec(const expr2tc &expr, object_mapt &dest)
 
           o.offset_alignment = std::min(index_align, old_align);
           o.offset_is_set = false;
+
+          // A constant index moves any bounds, other ones lose them
+          if(has_const_index_offset)
+          {
+            o.offset_min += index_offset;
+            o.offset_max += index_offset;
+          }
+          else
+            o.offset_bounded = false;
         }
 
         insert(dest, object, o);
@@ -916,6 +943,11 @@ void value_sett::get_reference_set_rec(const expr2tc &expr, object_mapt &dest)
         // of this. Also the same for references to indexes?
         if(o.offset_is_set)
           o.offset += offset_in_bytes;
+        else
+        {
+          o.offset_min += offset_in_bytes;
+          o.offset_max += offset_in_bytes;
+        }
 
         insert(dest, object, o);
       }
@@ -148,6 +148,14 @@ public:
      *  to the array element edges.
      *  Units are bytes. Zero means N/A. */
     unsigned int offset_alignment;
+    /** Whether offset_min and offset_max bound an offset that isn't set.
+     *  Together with the alignment they form a strided interval: the offset
+     *  is a multiple of offset_alignment in [offset_min, offset_max]. This
+     *  is what keeps a pointer walking an array from pointing "anywhere" in
+     *  it once the walk is merged. Units are bytes. */
+    bool offset_bounded = false;
+    BigInt offset_min;
+    BigInt offset_max;
     bool offset_is_zero() const
     {
       return offset_is_set && offset.is_zero();
@@ -377,23 +385,27 @@ public:
         return false;
 
       // Merge the tracking for two offsets; take the minimum alignment
-      // guarenteed by them.
+      // guarenteed by them, and remember the range they span.
       unsigned long old_align = offset2align(expr_obj, old.offset);
       unsigned long new_align = offset2align(expr_obj, object.offset);
       old.offset_is_set = false;
       old.offset_alignment = std::min(old_align, new_align);
+      old.offset_bounded = true;
+      old.offset_min = std::min(old.offset, object.offset);
+      old.offset_max = std::max(old.offset, object.offset);
       return true;
     }
 
     if(!old.offset_is_set)
     {
       unsigned int oldalign = old.offset_alignment;
+      bool bounds_changed = join_offset_bounds(old, object);
       if(!object.offset_is_set)
       {
         // Both object offsets not set; update alignment to minimum of the two
         old.offset_alignment =
           std::min(old.offset_alignment, object.offset_alignment);
-        return !(old.offset_alignment == oldalign);
+        return bounds_changed || !(old.offset_alignment == oldalign);
       }
 
       // Old offset unset; new offset set. Compute the alignment of the
@@ -401,13 +413,49 @@ public:
       // alignment.
       unsigned int new_alignment = offset2align(expr_obj, object.offset);
       old.offset_alignment = std::min(old.offset_alignment, new_alignment);
-      return !(old.offset_alignment == oldalign);
+      return bounds_changed || !(old.offset_alignment == oldalign);
     }
 
     // Old offset alignment is set; new isn't.
     unsigned int old_align = offset2align(expr_obj, old.offset);
     old.offset_alignment = std::min(old_align, object.offset_alignment);
     old.offset_is_set = false;
+    old.offset_bounded = object.offset_bounded;
+    if(old.offset_bounded)
+    {
+      old.offset_min = std::min(old.offset, object.offset_min);
+      old.offset_max = std::max(old.offset, object.offset_max);
+    }
+    return true;
+  }
+
+  /** Widen the offset bounds of old, whose offset isn't set, to cover those
+   *  of object. Bounds are only stretched to take in set offsets; when two
+   *  ranges that disagree are merged, the bounds are dropped altogether.
+   *  That's what makes fixedpoints over pointers walking in loops terminate.
+   *  @return True if old's bounds changed. */
+  static bool join_offset_bounds(objectt &old, const objectt &object)
+  {
+    if(!old.offset_bounded)
+      return false;
+
+    if(object.offset_is_set)
+    {
+      if(object.offset < old.offset_min)
+        old.offset_min = object.offset;
+      else if(object.offset > old.offset_max)
+        old.offset_max = object.offset;
+      else
+        return false;
+      return true;
+    }
+
+    if(
+      object.offset_bounded && object.offset_min >= old.offset_min &&
+      object.offset_max <= old.offset_max)
+      return false;
+
+    old.offset_bounded = false;
     return true;
   }
 
@@ -99,7 +99,6 @@ expr2tc cvc_convt::get_array_elem(
   smt_astt tmpast = mk_smt_bv(BigInt(index), mk_bv_sort(orig_w));
   auto const *tmpa = to_solver_smt_ast<cvc_smt_ast>(tmpast);
   CVC4::Expr e = em.mkExpr(CVC4::kind::SELECT, carray->a, tmpa->a);
-  delete tmpast;
 
   return get_by_ast(subtype, new_ast(e, convert_sort(subtype)));
 }
@@ -1212,28 +1211,29 @@ cvc_convt::convert_array_of(smt_astt init_val, unsigned long domain_width)
 
 smt_sortt cvc_convt::mk_bool_sort()
 {
-  return new solver_smt_sort<CVC4::Type>(SMT_SORT_BOOL, em.booleanType(), 1);
+  return new(this) solver_smt_sort<CVC4::Type>(
+    SMT_SORT_BOOL, em.booleanType(), 1);
 }
 
 smt_sortt cvc_convt::mk_real_sort()
 {
-  return new solver_smt_sort<CVC4::Type>(SMT_SORT_REAL, em.realType());
+  return new(this) solver_smt_sort<CVC4::Type>(SMT_SORT_REAL, em.realType());
 }
 
 smt_sortt cvc_convt::mk_int_sort()
 {
-  return new solver_smt_sort<CVC4::Type>(SMT_SORT_INT, em.integerType());
+  return new(this) solver_smt_sort<CVC4::Type>(SMT_SORT_INT, em.integerType());
 }
 
 smt_sortt cvc_convt::mk_bv_sort(std::size_t width)
 {
-  return new solver_smt_sort<CVC4::Type>(
+  return new(this) solver_smt_sort<CVC4::Type>(
     SMT_SORT_BV, em.mkBitVectorType(width), width);
 }
 
 smt_sortt cvc_convt::mk_fbv_sort(std::size_t width)
 {
-  return new solver_smt_sort<CVC4::Type>(
+  return new(this) solver_smt_sort<CVC4::Type>(
     SMT_SORT_FIXEDBV, em.mkBitVectorType(width), width);
 }
 
@@ -1243,31 +1243,31 @@ smt_sortt cvc_convt::mk_array_sort(smt_sortt domain, smt_sortt range)
   auto range_sort = to_solver_smt_sort<CVC4::Type>(range);
 
   auto t = em.mkArrayType(domain_sort->s, range_sort->s);
-  return new solver_smt_sort<CVC4::Type>(
+  return new(this) solver_smt_sort<CVC4::Type>(
     SMT_SORT_ARRAY, t, domain->get_data_width(), range);
 }
 
 smt_sortt cvc_convt::mk_bvfp_sort(std::size_t ew, std::size_t sw)
 {
-  return new solver_smt_sort<CVC4::Type>(
+  return new(this) solver_smt_sort<CVC4::Type>(
     SMT_SORT_BVFP, em.mkBitVectorType(ew + sw + 1), ew + sw + 1, sw + 1);
 }
 
 smt_sortt cvc_convt::mk_bvfp_rm_sort()
 {
-  return new solver_smt_sort<CVC4::Type>(
+  return new(this) solver_smt_sort<CVC4::Type>(
     SMT_SORT_BVFP_RM, em.mkBitVectorType(3), 3);
 }
 
 smt_sortt cvc_convt::mk_fpbv_sort(const unsigned ew, const unsigned sw)
 {
-  return new solver_smt_sort<CVC4::Type>(
+  return new(this) solver_smt_sort<CVC4::Type>(
     SMT_SORT_FPBV, em.mkFloatingPointType(ew, sw + 1), ew + sw + 1, sw + 1);
 }
 
 smt_sortt cvc_convt::mk_fpbv_rm_sort()
 {
-  return new solver_smt_sort<CVC4::Type>(
+  return new(this) solver_smt_sort<CVC4::Type>(
     SMT_SORT_FPBV_RM, em.roundingModeType(), 3);
 }
 
@@ -301,15 +301,15 @@ smt_sort *bitblast_convt::mk_sort(smt_sort_kind k, ...)
   case SMT_SORT_BV:
     uint = va_arg(ap, unsigned long);
     thebool = va_arg(ap, int);
-    s = new bitblast_smt_sort(k, uint, thebool);
+    s = new(this) bitblast_smt_sort(k, uint, thebool);
     break;
   case SMT_SORT_ARRAY:
     dom = va_arg(ap, bitblast_smt_sort *); // Consider constness?
     range = va_arg(ap, bitblast_smt_sort *);
-    s = new bitblast_smt_sort(k, range->data_width, dom->data_width);
+    s = new(this) bitblast_smt_sort(k, range->data_width, dom->data_width);
     break;
   case SMT_SORT_BOOL:
-    s = new bitblast_smt_sort(k);
+    s = new(this) bitblast_smt_sort(k);
     break;
   default:
     msg.error(
@@ -235,13 +235,13 @@ public:
 
   inline array_ast *new_ast(smt_sortt _s, const messaget &msg)
   {
-    return new array_ast(this, ctx, _s, msg);
+    return new(ctx) array_ast(this, ctx, _s, msg);
   }
 
   inline array_ast *
   new_ast(smt_sortt _s, const std::vector<smt_astt> &_a, const messaget &msg)
   {
-    return new array_ast(this, ctx, _s, _a, msg);
+    return new(ctx) array_ast(this, ctx, _s, _a, msg);
   }
 
   void push_array_ctx() override;
@@ -40,6 +40,14 @@ public:
   smt_ast(smt_convt *ctx, smt_sortt s, const messaget &msg);
   virtual ~smt_ast() = default;
 
+  /** ASTs are allocated in the region of the converter that owns them, and
+   *  are released in bulk by that converter, never deleted one by one. Use
+   *  as: new(ctx) some_smt_ast(ctx, ...). */
+  static void *operator new(std::size_t size, smt_convt *ctx);
+  static void operator delete(void *, smt_convt *)
+  {
+  }
+
   // "this" is the true operand.
   virtual smt_astt ite(smt_convt *ctx, smt_astt cond, smt_astt falseop) const;
 
@@ -90,6 +98,11 @@ public:
 
 protected:
   const messaget &_msg;
+
+  // Only reachable from destructors; the memory belongs to the region
+  static void operator delete(void *)
+  {
+  }
 };
 
 template <typename solver_ast>
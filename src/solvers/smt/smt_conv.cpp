@@ -65,7 +65,12 @@ smt_convt::smt_convt(
   const namespacet &_ns,
   const optionst &_options,
   const messaget &msg)
-  : ctx_level(0), boolean_sort(nullptr), ns(_ns), options(_options), msg(msg)
+  : ctx_level(0),
+    boolean_sort(nullptr),
+    ns(_ns),
+    options(_options),
+    msg(msg),
+    term_dag(this)
 {
   int_encoding = options.get_bool_option("int-encoding");
   tuple_api = nullptr;
@@ -132,10 +137,15 @@ void smt_convt::set_fp_conv(fp_convt *iface)
 
 void smt_convt::delete_all_asts()
 {
-  // Erase all the remaining asts in the live ast vector.
-  for(auto *ast : live_asts)
-    delete ast;
+  // Destroy all the remaining asts in the live ast vector, then hand their
+  // memory back to the region in one go.
+  for(auto it = live_asts.rbegin(); it != live_asts.rend(); ++it)
+    (*it)->~smt_ast();
   live_asts.clear();
+  live_asts_sizes.clear();
+  ast_region_marks.clear();
+  ast_region.release(smt_regiont::markt{0, 0});
+  term_dag.clear();
 }
 
 void smt_convt::smt_post_init()
@@ -174,6 +184,8 @@ void smt_convt::push_ctx()
   renumber_map.push_back(renumber_map.back());
 
   live_asts_sizes.push_back(live_asts.size());
+  ast_region_marks.push_back(ast_region.mark());
+  term_dag.push_ctx();
 
   ctx_level++;
 }
@@ -190,15 +202,17 @@ void smt_convt::pop_ctx()
   renumber_map.pop_back();
 
   ctx_level--;
+  term_dag.pop_ctx();
 
-  // Go through all the asts created since the last push and delete them.
+  // Go through all the asts created since the last push and destroy them.
+  for(std::size_t idx = live_asts.size(); idx > live_asts_sizes.back(); idx--)
+    live_asts[idx - 1]->~smt_ast();
 
-  for(unsigned int idx = live_asts_sizes.back(); idx < live_asts.size(); idx++)
-    delete live_asts[idx];
-
-  // And reset the storage back to that point.
+  // And reset the storage back to that point, releasing their memory.
   live_asts.resize(live_asts_sizes.back());
   live_asts_sizes.pop_back();
+  ast_region.release(ast_region_marks.back());
+  ast_region_marks.pop_back();
 
   array_api->pop_array_ctx();
   tuple_api->pop_tuple_ctx();
@@ -207,13 +221,13 @@ void smt_convt::pop_ctx()
 smt_astt smt_convt::invert_ast(smt_astt a)
 {
   assert(a->sort->id == SMT_SORT_BOOL);
-  return mk_not(a);
+  return term_dag.mk_not(a);
 }
 
 smt_astt smt_convt::imply_ast(smt_astt a, smt_astt b)
 {
   assert(a->sort->id == SMT_SORT_BOOL && b->sort->id == SMT_SORT_BOOL);
-  return mk_implies(a, b);
+  return term_dag.mk_implies(a, b);
 }
 
 void smt_convt::set_to(const expr2tc &expr, bool value)
@@ -785,7 +799,7 @@ smt_astt smt_convt::convert_ast(const expr2tc &expr)
       a = fp_api->mk_smt_fpbv_eq(args[0], args[1]);
     else
       a = args[0]->eq(this, args[1]);
-    a = mk_not(a);
+    a = term_dag.mk_not(a);
     break;
   }
   case expr2t::shl_id:
@@ -1014,12 +1028,12 @@ smt_astt smt_convt::convert_ast(const expr2tc &expr)
     assert(
       !int_encoding &&
       "Concatenate encountered in integer mode; unimplemented (and funky)");
-    a = mk_concat(args[0], args[1]);
+    a = term_dag.mk_concat(args[0], args[1]);
     break;
   }
   case expr2t::implies_id:
   {
-    a = mk_implies(args[0], args[1]);
+    a = term_dag.mk_implies(args[0], args[1]);
     break;
   }
   case expr2t::bitand_id:
@@ -1067,7 +1081,7 @@ smt_astt smt_convt::convert_ast(const expr2tc &expr)
   case expr2t::not_id:
   {
     assert(is_bool_type(expr));
-    a = mk_not(args[0]);
+    a = term_dag.mk_not(args[0]);
     break;
   }
   case expr2t::neg_id:
@@ -1089,17 +1103,17 @@ smt_astt smt_convt::convert_ast(const expr2tc &expr)
   }
   case expr2t::and_id:
   {
-    a = mk_and(args[0], args[1]);
+    a = term_dag.mk_and(args[0], args[1]);
     break;
   }
   case expr2t::or_id:
   {
-    a = mk_or(args[0], args[1]);
+    a = term_dag.mk_or(args[0], args[1]);
     break;
   }
   case expr2t::xor_id:
   {
-    a = mk_xor(args[0], args[1]);
+    a = term_dag.mk_xor(args[0], args[1]);
     break;
   }
   case expr2t::bitcast_id:
@@ -1113,7 +1127,7 @@ smt_astt smt_convt::convert_ast(const expr2tc &expr)
     a = convert_ast(ex.from);
     if(ex.from->type->get_width() == ex.upper - ex.lower + 1)
       return a;
-    a = mk_extract(a, ex.upper, ex.lower);
+    a = term_dag.mk_extract(a, ex.upper, ex.lower);
     break;
   }
   default:
@@ -1284,7 +1298,7 @@ smt_astt smt_convt::convert_terminal(const expr2tc &expr)
     if(int_encoding)
       return mk_smt_int(theint.value);
 
-    return mk_smt_bv(theint.value, width);
+    return term_dag.mk_bv(theint.value, width);
   }
   case expr2t::constant_fixedbv_id:
   {
@@ -1341,7 +1355,7 @@ smt_astt smt_convt::convert_terminal(const expr2tc &expr)
   case expr2t::constant_bool_id:
   {
     const constant_bool2t &thebool = to_constant_bool2t(expr);
-    return mk_smt_bool(thebool.value);
+    return term_dag.mk_bool(thebool.value);
   }
   case expr2t::symbol_id:
   {
@@ -2592,12 +2606,16 @@ void smt_ast::assign(smt_convt *ctx, smt_astt sym) const
 
 smt_astt smt_ast::ite(smt_convt *ctx, smt_astt cond, smt_astt falseop) const
 {
+  if(smt_term_dagt::handles(sort))
+    return ctx->term_dag.mk_ite(cond, this, falseop);
   return ctx->mk_ite(cond, this, falseop);
 }
 
 smt_astt smt_ast::eq(smt_convt *ctx, smt_astt other) const
 {
   // Simple approach: this is a leaf piece of SMT, compute a basic equality.
+  if(smt_term_dagt::handles(sort))
+    return ctx->term_dag.mk_eq(this, other);
   return ctx->mk_eq(this, other);
 }
 
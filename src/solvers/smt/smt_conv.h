@@ -8,6 +8,8 @@
 #include <cstdint>
 #include <solvers/prop/literal.h>
 #include <solvers/prop/pointer_logic.h>
+#include <solvers/smt/smt_region.h>
+#include <solvers/smt/smt_term_dag.h>
 #include <irep2/irep2_utils.h>
 #include <util/message/message.h>
 #include <util/namespace.h>
@@ -142,7 +144,7 @@ public:
   smt_astt
   new_solver_ast(typename the_solver_ast::solver_ast_type ast, smt_sortt sort)
   {
-    return new the_solver_ast(this, ast, sort, msg);
+    return new(this) the_solver_ast(this, ast, sort, msg);
   }
 
   /** Primary constructor. After construction, smt_post_init must be called
@@ -852,13 +854,23 @@ public:
   typedef std::map<std::string, smt_astt> renumber_mapt;
   std::vector<renumber_mapt> renumber_map;
 
+  /** Storage for all smt ast's. Each context level allocates from the end
+   *  of the region, so popping a context releases its memory at once. */
+  smt_regiont ast_region;
+  /** Storage for sorts, which are cached across context levels and so live
+   *  as long as the converter. */
+  smt_regiont sort_region;
   /** Lifetime tracking of smt ast's. When a context is pop'd, all the ASTs
-   *  created in that context are freed. */
+   *  created in that context are destroyed. */
   std::vector<smt_astt> live_asts;
   /** Accounting of live_asts for push/pop. Records the number of pointers
-   *  contained when a push occurred. On pop, the live_asts vector is reset
-   *  back to that point. */
+   *  contained when a push occurred, and the position of the ast region at
+   *  that point. On pop, both are reset back to that point. */
   std::vector<unsigned int> live_asts_sizes;
+  std::vector<smt_regiont::markt> ast_region_marks;
+  /** Structurally hashed Boolean and bit-vector terms, shared by all
+   *  backends. @see smt_term_dagt */
+  smt_term_dagt term_dag;
 
   tuple_iface *tuple_api;
   array_iface *array_api;
@@ -877,4 +889,14 @@ inline smt_ast::smt_ast(smt_convt *ctx, smt_sortt s, const messaget &msg)
   ctx->live_asts.push_back(this);
 }
 
+inline void *smt_ast::operator new(std::size_t size, smt_convt *ctx)
+{
+  return ctx->ast_region.alloc(size);
+}
+
+inline void *smt_sort::operator new(std::size_t size, smt_convt *ctx)
+{
+  return ctx->sort_region.alloc(size);
+}
+
 #endif /* _ESBMC_PROP_SMT_SMT_CONV_H_ */
@@ -0,0 +1,90 @@
+#ifndef SOLVERS_SMT_SMT_REGION_H_
+#define SOLVERS_SMT_SMT_REGION_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/** Bump allocator for the smt_ast and smt_sort wrappers of a converter.
+ *  Allocation advances a pointer through a list of chunks; nothing is freed
+ *  individually. A mark records the current position, and releasing a mark
+ *  makes everything allocated after it available again in O(1), which is how
+ *  smt_convt drops all the ASTs of a context level on pop_ctx. Chunks are kept
+ *  for reuse by later levels and only returned to the system when the region
+ *  is destroyed.
+ *
+ *  The region never runs destructors; that is left to the owner. */
+class smt_regiont
+{
+public:
+  struct markt
+  {
+    std::size_t chunk;
+    std::size_t used;
+  };
+
+  explicit smt_regiont(std::size_t _chunk_size = 64 * 1024)
+    : chunk_size(_chunk_size), cur(0), used(0)
+  {
+    chunks.emplace_back(chunk_size);
+  }
+
+  smt_regiont(const smt_regiont &) = delete;
+  smt_regiont &operator=(const smt_regiont &) = delete;
+
+  void *alloc(std::size_t size)
+  {
+    const std::size_t align = alignof(std::max_align_t);
+    size = (size + align - 1) & ~(align - 1);
+
+    if(used + size > chunks[cur].size)
+      next_chunk(size);
+
+    void *p = chunks[cur].data.get() + used;
+    used += size;
+    return p;
+  }
+
+  markt mark() const
+  {
+    return {cur, used};
+  }
+
+  void release(const markt &m)
+  {
+    cur = m.chunk;
+    used = m.used;
+  }
+
+protected:
+  struct chunkt
+  {
+    explicit chunkt(std::size_t s) : data(new char[s]), size(s)
+    {
+    }
+
+    std::unique_ptr<char[]> data;
+    std::size_t size;
+  };
+
+  void next_chunk(std::size_t size)
+  {
+    used = 0;
+
+    // Reuse the chunks of released levels if they are large enough
+    while(++cur < chunks.size())
+      if(chunks[cur].size >= size)
+        return;
+
+    chunks.emplace_back(std::max(size, chunk_size));
+    cur = chunks.size() - 1;
+  }
+
+  std::size_t chunk_size;
+  std::vector<chunkt> chunks;
+  std::size_t cur;
+  std::size_t used;
+};
+
+#endif /* SOLVERS_SMT_SMT_REGION_H_ */
@@ -33,6 +33,7 @@ enum smt_sort_kind
  *  @see smt_ast
  */
 
+class smt_convt;
 class smt_sort;
 typedef const smt_sort *smt_sortt;
 
@@ -134,6 +135,20 @@ public:
 
   virtual ~smt_sort() = default;
 
+  /** Sorts are allocated in the sort region of the converter that creates
+   *  them and live as long as that converter. Use as:
+   *  new(ctx) some_smt_sort(...). */
+  static void *operator new(std::size_t size, smt_convt *ctx);
+  static void operator delete(void *, smt_convt *)
+  {
+  }
+
+protected:
+  // Only reachable from destructors; the memory belongs to the region
+  static void operator delete(void *)
+  {
+  }
+
 private:
   /** Data size of the sort.
    * For bitvectors and floating-points this is the bit width,
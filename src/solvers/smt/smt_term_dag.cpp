@@ -0,0 +1,365 @@
+#include <boost/functional/hash.hpp>
+#include <solvers/smt/smt_conv.h>
+#include <solvers/smt/smt_term_dag.h>
+#include <util/arith_tools.h>
+
+// Order of the operands of commutative terms in their key
+static smt_astt first(smt_astt a, smt_astt b)
+{
+  return std::less<smt_astt>()(a, b) ? a : b;
+}
+
+static smt_astt second(smt_astt a, smt_astt b)
+{
+  return std::less<smt_astt>()(a, b) ? b : a;
+}
+
+bool smt_term_dagt::termt::operator==(const termt &other) const
+{
+  return kind == other.kind && ops[0] == other.ops[0] &&
+         ops[1] == other.ops[1] && ops[2] == other.ops[2] &&
+         high == other.high && low == other.low && value == other.value;
+}
+
+size_t smt_term_dagt::term_hasht::operator()(const termt &t) const
+{
+  size_t seed = 0;
+  boost::hash_combine(seed, static_cast<int>(t.kind));
+  boost::hash_combine(seed, t.ops[0]);
+  boost::hash_combine(seed, t.ops[1]);
+  boost::hash_combine(seed, t.ops[2]);
+  boost::hash_combine(seed, t.high);
+  boost::hash_combine(seed, t.low);
+  // Wider constants collide on purpose; equality sorts them out
+  if(t.value.is_uint64())
+    boost::hash_combine(seed, t.value.to_uint64());
+  return seed;
+}
+
+smt_term_dagt::smt_term_dagt(smt_convt *_ctx) : ctx(_ctx)
+{
+}
+
+bool smt_term_dagt::handles(smt_sortt s)
+{
+  return s->id == SMT_SORT_BOOL || s->id == SMT_SORT_BV ||
+         s->id == SMT_SORT_INT || s->id == SMT_SORT_REAL;
+}
+
+template <typename F>
+smt_astt smt_term_dagt::lookup(const termt &t, F emit)
+{
+  auto it = table.find(t);
+  if(it != table.end())
+    return it->second;
+
+  smt_astt a = emit();
+  table.emplace(t, a);
+  terms[a] = t;
+  trail.push_back(t);
+  return a;
+}
+
+const smt_term_dagt::termt *smt_term_dagt::get_term(smt_astt a) const
+{
+  auto it = terms.find(a);
+  if(it == terms.end())
+    return nullptr;
+  return &it->second;
+}
+
+bool smt_term_dagt::is_const(smt_astt a, bool val) const
+{
+  const termt *t = get_term(a);
+  return t && t->kind == BOOL_CONST && t->value == (val ? 1 : 0);
+}
+
+bool smt_term_dagt::is_negation(smt_astt a, smt_astt b) const
+{
+  const termt *ta = get_term(a);
+  const termt *tb = get_term(b);
+  return (ta && ta->kind == NOT && ta->ops[0] == b) ||
+         (tb && tb->kind == NOT && tb->ops[0] == a);
+}
+
+std::size_t smt_term_dagt::width(smt_astt a)
+{
+  return a->sort->get_data_width();
+}
+
+smt_astt smt_term_dagt::mk_bool(bool val)
+{
+  termt t = {BOOL_CONST, {}, 0, 0, BigInt(val ? 1 : 0)};
+  return lookup(t, [this, val]() { return ctx->mk_smt_bool(val); });
+}
+
+smt_astt smt_term_dagt::mk_bv(const BigInt &val, std::size_t w)
+{
+  // Key on the value modulo 2^w, so that -1, 2^w - 1 and 2^(w+1) - 1 are
+  // all the same term; folding relies on distinct constants differing here
+  BigInt m = power(2, w);
+  BigInt v = val % m;
+  if(v.is_negative())
+    v += m;
+
+  termt t = {BV_CONST, {}, (unsigned int)w, 0, v};
+  return lookup(t, [this, &val, w]() { return ctx->mk_smt_bv(val, w); });
+}
+
+smt_astt smt_term_dagt::mk_not(smt_astt a)
+{
+  const termt *ta = get_term(a);
+  if(ta && ta->kind == BOOL_CONST)
+    return mk_bool(ta->value.is_zero());
+
+  if(ta && ta->kind == NOT)
+    return ta->ops[0];
+
+  termt t = {NOT, {a}, 0, 0, BigInt(0)};
+  return lookup(t, [this, a]() { return ctx->mk_not(a); });
+}
+
+smt_astt smt_term_dagt::mk_and(smt_astt a, smt_astt b)
+{
+  smt_astt res = nullptr;
+  if(is_const(a, false) || is_const(b, false) || is_negation(a, b))
+    res = mk_bool(false);
+  else if(is_const(a, true) || a == b)
+    res = b;
+  else if(is_const(b, true))
+    res = a;
+  else
+  {
+    // a & (a & c) is a & c
+    const termt *ta = get_term(a);
+    const termt *tb = get_term(b);
+    if(tb && tb->kind == AND && (tb->ops[0] == a || tb->ops[1] == a))
+      res = b;
+    else if(ta && ta->kind == AND && (ta->ops[0] == b || ta->ops[1] == b))
+      res = a;
+  }
+
+  if(res)
+    return res;
+
+  // Operands are ordered in the key only: the solver still sees a and b in
+  // the order they were given, which keeps exported formulas deterministic.
+  termt t = {AND, {first(a, b), second(a, b)}, 0, 0, BigInt(0)};
+  return lookup(t, [this, a, b]() { return ctx->mk_and(a, b); });
+}
+
+smt_astt smt_term_dagt::mk_or(smt_astt a, smt_astt b)
+{
+  smt_astt res = nullptr;
+  if(is_const(a, true) || is_const(b, true) || is_negation(a, b))
+    res = mk_bool(true);
+  else if(is_const(a, false) || a == b)
+    res = b;
+  else if(is_const(b, false))
+    res = a;
+  else
+  {
+    // a | (a | c) is a | c
+    const termt *ta = get_term(a);
+    const termt *tb = get_term(b);
+    if(tb && tb->kind == OR && (tb->ops[0] == a || tb->ops[1] == a))
+      res = b;
+    else if(ta && ta->kind == OR && (ta->ops[0] == b || ta->ops[1] == b))
+      res = a;
+  }
+
+  if(res)
+    return res;
+
+  termt t = {OR, {first(a, b), second(a, b)}, 0, 0, BigInt(0)};
+  return lookup(t, [this, a, b]() { return ctx->mk_or(a, b); });
+}
+
+smt_astt smt_term_dagt::mk_xor(smt_astt a, smt_astt b)
+{
+  smt_astt res = nullptr;
+  if(a == b)
+    res = mk_bool(false);
+  else if(is_negation(a, b))
+    res = mk_bool(true);
+  else if(is_const(a, false))
+    res = b;
+  else if(is_const(b, false))
+    res = a;
+  else if(is_const(a, true))
+    res = mk_not(b);
+  else if(is_const(b, true))
+    res = mk_not(a);
+
+  if(res)
+    return res;
+
+  termt t = {XOR, {first(a, b), second(a, b)}, 0, 0, BigInt(0)};
+  return lookup(t, [this, a, b]() { return ctx->mk_xor(a, b); });
+}
+
+smt_astt smt_term_dagt::mk_implies(smt_astt a, smt_astt b)
+{
+  smt_astt res = nullptr;
+  if(is_const(a, false) || is_const(b, true) || a == b)
+    res = mk_bool(true);
+  else if(is_const(a, true))
+    res = b;
+  else if(is_const(b, false))
+    res = mk_not(a);
+
+  if(res)
+    return res;
+
+  termt t = {IMPLIES, {a, b}, 0, 0, BigInt(0)};
+  return lookup(t, [this, a, b]() { return ctx->mk_implies(a, b); });
+}
+
+smt_astt smt_term_dagt::mk_ite(smt_astt cond, smt_astt t, smt_astt f)
+{
+  smt_astt res = nullptr;
+  if(is_const(cond, true) || t == f)
+    res = t;
+  else if(is_const(cond, false))
+    res = f;
+  else if(t->sort->id == SMT_SORT_BOOL)
+  {
+    // Boolean ITEs with a constant branch are plain AIG nodes
+    if(is_const(t, true))
+      res = mk_or(cond, f);
+    else if(is_const(t, false))
+      res = mk_and(mk_not(cond), f);
+    else if(is_const(f, true))
+      res = mk_or(mk_not(cond), t);
+    else if(is_const(f, false))
+      res = mk_and(cond, t);
+  }
+
+  if(!res)
+  {
+    // Strip negations off the condition by swapping the branches
+    const termt *tc = get_term(cond);
+    if(tc && tc->kind == NOT)
+      res = mk_ite(tc->ops[0], f, t);
+  }
+
+  if(res)
+    return res;
+
+  termt key = {ITE, {cond, t, f}, 0, 0, BigInt(0)};
+  return lookup(key, [this, cond, t, f]() { return ctx->mk_ite(cond, t, f); });
+}
+
+smt_astt smt_term_dagt::mk_eq(smt_astt a, smt_astt b)
+{
+  smt_astt res = nullptr;
+  const termt *ta = get_term(a);
+  const termt *tb = get_term(b);
+  if(a == b)
+    res = mk_bool(true);
+  else if(
+    ta && tb && ta->kind == tb->kind &&
+    (ta->kind == BOOL_CONST || ta->kind == BV_CONST))
+    // Constants are hashed, so distinct ASTs hold distinct values
+    res = mk_bool(false);
+  else if(is_const(a, true))
+    res = b;
+  else if(is_const(b, true))
+    res = a;
+  else if(is_const(a, false))
+    res = mk_not(b);
+  else if(is_const(b, false))
+    res = mk_not(a);
+  else if(is_negation(a, b))
+    res = mk_bool(false);
+
+  if(res)
+    return res;
+
+  termt t = {EQ, {first(a, b), second(a, b)}, 0, 0, BigInt(0)};
+  return lookup(t, [this, a, b]() { return ctx->mk_eq(a, b); });
+}
+
+smt_astt
+smt_term_dagt::mk_extract(smt_astt a, unsigned int high, unsigned int low)
+{
+  assert(high >= low && high < width(a));
+  smt_astt res = nullptr;
+  const termt *ta = get_term(a);
+  if(low == 0 && high + 1 == width(a))
+    res = a;
+  else if(ta && ta->kind == BV_CONST)
+  {
+    BigInt v = ta->value / power(2, low);
+    res = mk_bv(v % power(2, high - low + 1), high - low + 1);
+  }
+  else if(ta && ta->kind == EXTRACT)
+    res = mk_extract(ta->ops[0], ta->low + high, ta->low + low);
+  else if(ta && ta->kind == CONCAT)
+  {
+    // Extract from whichever half the bits come from, if only one
+    unsigned int lo_width = width(ta->ops[1]);
+    if(low >= lo_width)
+      res = mk_extract(ta->ops[0], high - lo_width, low - lo_width);
+    else if(high < lo_width)
+      res = mk_extract(ta->ops[1], high, low);
+  }
+
+  if(res)
+    return res;
+
+  termt t = {EXTRACT, {a}, high, low, BigInt(0)};
+  return lookup(
+    t, [this, a, high, low]() { return ctx->mk_extract(a, high, low); });
+}
+
+smt_astt smt_term_dagt::mk_concat(smt_astt a, smt_astt b)
+{
+  smt_astt res = nullptr;
+  const termt *ta = get_term(a);
+  const termt *tb = get_term(b);
+  if(ta && tb && ta->kind == BV_CONST && tb->kind == BV_CONST)
+  {
+    BigInt v = ta->value * power(2, width(b)) + tb->value;
+    res = mk_bv(v, width(a) + width(b));
+  }
+  else if(
+    ta && tb && ta->kind == EXTRACT && tb->kind == EXTRACT &&
+    ta->ops[0] == tb->ops[0] && ta->low == tb->high + 1)
+  {
+    // Adjacent slices of the same vector
+    res = mk_extract(ta->ops[0], ta->high, tb->low);
+  }
+
+  if(res)
+    return res;
+
+  termt t = {CONCAT, {a, b}, 0, 0, BigInt(0)};
+  return lookup(t, [this, a, b]() { return ctx->mk_concat(a, b); });
+}
+
+void smt_term_dagt::push_ctx()
+{
+  trail_marks.push_back(trail.size());
+}
+
+void smt_term_dagt::pop_ctx()
+{
+  // The ASTs of everything inserted since the push are about to be destroyed
+  while(trail.size() > trail_marks.back())
+  {
+    auto it = table.find(trail.back());
+    terms.erase(it->second);
+    table.erase(it);
+    trail.pop_back();
+  }
+  trail_marks.pop_back();
+}
+
+void smt_term_dagt::clear()
+{
+  table.clear();
+  terms.clear();
+  trail.clear();
+  trail_marks.clear();
+}
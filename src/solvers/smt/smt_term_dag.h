@@ -0,0 +1,108 @@
+#ifndef SOLVERS_SMT_SMT_TERM_DAG_H_
+#define SOLVERS_SMT_SMT_TERM_DAG_H_
+
+#include <big-int/bigint.hh>
+#include <solvers/smt/smt_ast.h>
+#include <unordered_map>
+#include <vector>
+
+/** Solver independent layer of structurally hashed terms.
+ *  smt_convt builds the Boolean and bit-vector glue of a formula through this
+ *  class rather than calling the backend mk_* methods directly. Each term is
+ *  looked up in a hash table keyed on its operator, operand ASTs and
+ *  parameters, so a term is only handed to the solver once per context level
+ *  no matter how many expressions produce it. Before a term is emitted a few
+ *  cheap local rewrites are tried:
+ *
+ *   - Boolean and bit-vector constant folding;
+ *   - AIG-style simplification of and/or/not/xor/implies (idempotence,
+ *     complements, absorption of constants, double negation);
+ *   - if-then-else with a constant condition or equal branches, and Boolean
+ *     ITEs with constant branches turned into and/or;
+ *   - extract of extract, extract of concat and concat of adjacent extracts
+ *     normalised to a single extract, and full-width extracts dropped.
+ *
+ *  As every backend sits behind smt_convt, they all get the same sharing and
+ *  preprocessing, and exported formulas shrink accordingly.
+ *
+ *  Only terms of Boolean, bit-vector, integer and real sort go through here;
+ *  tuples and arrays have their own ite/eq methods on the AST. Entries are
+ *  removed when the context level that created their ASTs is popped. */
+class smt_term_dagt
+{
+public:
+  explicit smt_term_dagt(smt_convt *_ctx);
+
+  /** Whether terms of this sort may be built through the DAG. */
+  static bool handles(smt_sortt s);
+
+  smt_astt mk_bool(bool val);
+  smt_astt mk_bv(const BigInt &val, std::size_t width);
+
+  smt_astt mk_not(smt_astt a);
+  smt_astt mk_and(smt_astt a, smt_astt b);
+  smt_astt mk_or(smt_astt a, smt_astt b);
+  smt_astt mk_xor(smt_astt a, smt_astt b);
+  smt_astt mk_implies(smt_astt a, smt_astt b);
+  smt_astt mk_ite(smt_astt cond, smt_astt t, smt_astt f);
+  smt_astt mk_eq(smt_astt a, smt_astt b);
+  smt_astt mk_extract(smt_astt a, unsigned int high, unsigned int low);
+  smt_astt mk_concat(smt_astt a, smt_astt b);
+
+  void push_ctx();
+  void pop_ctx();
+  /** Forget every term; used when all ASTs are destroyed at once. */
+  void clear();
+
+protected:
+  enum kindt
+  {
+    BOOL_CONST,
+    BV_CONST,
+    NOT,
+    AND,
+    OR,
+    XOR,
+    IMPLIES,
+    ITE,
+    EQ,
+    EXTRACT,
+    CONCAT
+  };
+
+  struct termt
+  {
+    kindt kind;
+    smt_astt ops[3];
+    unsigned int high;
+    unsigned int low;
+    BigInt value;
+
+    bool operator==(const termt &other) const;
+  };
+
+  struct term_hasht
+  {
+    size_t operator()(const termt &t) const;
+  };
+
+  /** Find a previously emitted term, or emit it with the given backend call
+   *  and record it. */
+  template <typename F>
+  smt_astt lookup(const termt &t, F emit);
+
+  /** Structure of an AST emitted through the DAG, or nullptr */
+  const termt *get_term(smt_astt a) const;
+  bool is_const(smt_astt a, bool val) const;
+  bool is_negation(smt_astt a, smt_astt b) const;
+  static std::size_t width(smt_astt a);
+
+  smt_convt *ctx;
+  std::unordered_map<termt, smt_astt, term_hasht> table;
+  std::unordered_map<smt_astt, termt> terms;
+  /** Terms inserted in order, and the length of that list at each push */
+  std::vector<termt> trail;
+  std::vector<std::size_t> trail_marks;
+};
+
+#endif /* SOLVERS_SMT_SMT_TERM_DAG_H_ */
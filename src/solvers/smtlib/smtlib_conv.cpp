@@ -790,7 +790,7 @@ void smtlib_convt::assert_ast(smt_astt a)
 smt_astt smtlib_convt::mk_smt_int(const BigInt &theint)
 {
   smt_sortt s = mk_int_sort();
-  smtlib_smt_ast *a = new smtlib_smt_ast(this, s, SMT_FUNC_INT, msg);
+  smtlib_smt_ast *a = new(this) smtlib_smt_ast(this, s, SMT_FUNC_INT, msg);
   a->intval = theint;
   return a;
 }
@@ -798,14 +798,14 @@ smt_astt smtlib_convt::mk_smt_int(const BigInt &theint)
 smt_astt smtlib_convt::mk_smt_real(const std::string &str)
 {
   smt_sortt s = mk_real_sort();
-  smtlib_smt_ast *a = new smtlib_smt_ast(this, s, SMT_FUNC_REAL, msg);
+  smtlib_smt_ast *a = new(this) smtlib_smt_ast(this, s, SMT_FUNC_REAL, msg);
   a->realval = str;
   return a;
 }
 
 smt_astt smtlib_convt::mk_smt_bv(const BigInt &theint, smt_sortt s)
 {
-  smtlib_smt_ast *a = new smtlib_smt_ast(this, s, SMT_FUNC_BVINT, msg);
+  smtlib_smt_ast *a = new(this) smtlib_smt_ast(this, s, SMT_FUNC_BVINT, msg);
   a->intval = theint;
   return a;
 }
@@ -813,7 +813,7 @@ smt_astt smtlib_convt::mk_smt_bv(const BigInt &theint, smt_sortt s)
 smt_astt smtlib_convt::mk_smt_bool(bool val)
 {
   smtlib_smt_ast *a =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BOOL, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BOOL, msg);
   a->boolval = val;
   return a;
 }
@@ -828,7 +828,7 @@ smt_astt smtlib_convt::mk_array_symbol(
 
 smt_astt smtlib_convt::mk_smt_symbol(const std::string &name, const smt_sort *s)
 {
-  smtlib_smt_ast *a = new smtlib_smt_ast(this, s, SMT_FUNC_SYMBOL, msg);
+  smtlib_smt_ast *a = new(this) smtlib_smt_ast(this, s, SMT_FUNC_SYMBOL, msg);
   a->symname = name;
 
   symbol_tablet::iterator it = symbol_table.find(name);
@@ -863,7 +863,7 @@ smt_astt
 smtlib_convt::mk_extract(smt_astt a, unsigned int high, unsigned int low)
 {
   smt_sortt s = mk_bv_sort(high - low + 1);
-  smtlib_smt_ast *n = new smtlib_smt_ast(this, s, SMT_FUNC_EXTRACT, msg);
+  smtlib_smt_ast *n = new(this) smtlib_smt_ast(this, s, SMT_FUNC_EXTRACT, msg);
   n->extract_high = high;
   n->extract_low = low;
   n->args.push_back(a);
@@ -899,7 +899,8 @@ smt_astt smtlib_convt::mk_zero_ext(smt_astt a, unsigned int topwidth)
 
 smt_astt smtlib_convt::mk_concat(smt_astt a, smt_astt b)
 {
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_CONCAT, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_CONCAT, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -910,7 +911,8 @@ smt_astt smtlib_convt::mk_ite(smt_astt cond, smt_astt t, smt_astt f)
   assert(cond->sort->id == SMT_SORT_BOOL);
   assert(t->sort->get_data_width() == f->sort->get_data_width());
 
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, t->sort, SMT_FUNC_ITE, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, t->sort, SMT_FUNC_ITE, msg);
   ast->args.push_back(cond);
   ast->args.push_back(t);
   ast->args.push_back(f);
@@ -937,7 +939,8 @@ smt_astt smtlib_convt::mk_add(smt_astt a, smt_astt b)
   assert(a->sort->id == SMT_SORT_INT || a->sort->id == SMT_SORT_REAL);
   assert(b->sort->id == SMT_SORT_INT || b->sort->id == SMT_SORT_REAL);
   assert(a->sort->id == b->sort->id);
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_ADD, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_ADD, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -948,7 +951,8 @@ smt_astt smtlib_convt::mk_bvadd(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVADD, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVADD, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -959,7 +963,8 @@ smt_astt smtlib_convt::mk_sub(smt_astt a, smt_astt b)
   assert(a->sort->id == SMT_SORT_INT || a->sort->id == SMT_SORT_REAL);
   assert(b->sort->id == SMT_SORT_INT || b->sort->id == SMT_SORT_REAL);
   assert(a->sort->id == b->sort->id);
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_SUB, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_SUB, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -970,7 +975,8 @@ smt_astt smtlib_convt::mk_bvsub(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVSUB, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVSUB, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -981,7 +987,8 @@ smt_astt smtlib_convt::mk_mul(smt_astt a, smt_astt b)
   assert(a->sort->id == SMT_SORT_INT || a->sort->id == SMT_SORT_REAL);
   assert(b->sort->id == SMT_SORT_INT || b->sort->id == SMT_SORT_REAL);
   assert(a->sort->id == b->sort->id);
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_MUL, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_MUL, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -992,7 +999,8 @@ smt_astt smtlib_convt::mk_bvmul(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVMUL, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVMUL, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1003,7 +1011,8 @@ smt_astt smtlib_convt::mk_mod(smt_astt a, smt_astt b)
   assert(a->sort->id == SMT_SORT_INT || a->sort->id == SMT_SORT_REAL);
   assert(b->sort->id == SMT_SORT_INT || b->sort->id == SMT_SORT_REAL);
   assert(a->sort->id == b->sort->id);
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_MOD, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_MOD, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1014,7 +1023,8 @@ smt_astt smtlib_convt::mk_bvsmod(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVSMOD, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVSMOD, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1025,7 +1035,8 @@ smt_astt smtlib_convt::mk_bvumod(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVUMOD, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVUMOD, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1036,7 +1047,8 @@ smt_astt smtlib_convt::mk_div(smt_astt a, smt_astt b)
   assert(a->sort->id == SMT_SORT_INT || a->sort->id == SMT_SORT_REAL);
   assert(b->sort->id == SMT_SORT_INT || b->sort->id == SMT_SORT_REAL);
   assert(a->sort->id == b->sort->id);
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_DIV, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_DIV, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1047,7 +1059,8 @@ smt_astt smtlib_convt::mk_bvsdiv(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVSDIV, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVSDIV, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1058,7 +1071,8 @@ smt_astt smtlib_convt::mk_bvudiv(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVUDIV, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVUDIV, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1069,7 +1083,8 @@ smt_astt smtlib_convt::mk_shl(smt_astt a, smt_astt b)
   assert(a->sort->id == SMT_SORT_INT || a->sort->id == SMT_SORT_REAL);
   assert(b->sort->id == SMT_SORT_INT || b->sort->id == SMT_SORT_REAL);
   assert(a->sort->id == b->sort->id);
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_SHL, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_SHL, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1080,7 +1095,8 @@ smt_astt smtlib_convt::mk_bvshl(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVSHL, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVSHL, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1091,7 +1107,8 @@ smt_astt smtlib_convt::mk_bvashr(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVASHR, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVASHR, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1102,7 +1119,8 @@ smt_astt smtlib_convt::mk_bvlshr(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVLSHR, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVLSHR, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1111,7 +1129,8 @@ smt_astt smtlib_convt::mk_bvlshr(smt_astt a, smt_astt b)
 smt_astt smtlib_convt::mk_neg(smt_astt a)
 {
   assert(a->sort->id == SMT_SORT_INT || a->sort->id == SMT_SORT_REAL);
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_NEG, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_NEG, msg);
   ast->args.push_back(a);
   return ast;
 }
@@ -1119,7 +1138,8 @@ smt_astt smtlib_convt::mk_neg(smt_astt a)
 smt_astt smtlib_convt::mk_bvneg(smt_astt a)
 {
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVNEG, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVNEG, msg);
   ast->args.push_back(a);
   return ast;
 }
@@ -1127,7 +1147,8 @@ smt_astt smtlib_convt::mk_bvneg(smt_astt a)
 smt_astt smtlib_convt::mk_bvnot(smt_astt a)
 {
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVNOT, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVNOT, msg);
   ast->args.push_back(a);
   return ast;
 }
@@ -1137,7 +1158,8 @@ smt_astt smtlib_convt::mk_bvnxor(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVNXOR, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVNXOR, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1148,7 +1170,8 @@ smt_astt smtlib_convt::mk_bvnor(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVNOR, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVNOR, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1159,7 +1182,8 @@ smt_astt smtlib_convt::mk_bvnand(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVNAND, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVNAND, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1170,7 +1194,8 @@ smt_astt smtlib_convt::mk_bvxor(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVXOR, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVXOR, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1181,7 +1206,8 @@ smt_astt smtlib_convt::mk_bvor(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVOR, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVOR, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1192,7 +1218,8 @@ smt_astt smtlib_convt::mk_bvand(smt_astt a, smt_astt b)
   assert(a->sort->id != SMT_SORT_INT && a->sort->id != SMT_SORT_REAL);
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_BVAND, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_BVAND, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1202,7 +1229,7 @@ smt_astt smtlib_convt::mk_implies(smt_astt a, smt_astt b)
 {
   assert(a->sort->id == SMT_SORT_BOOL && b->sort->id == SMT_SORT_BOOL);
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_IMPLIES, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_IMPLIES, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1212,7 +1239,7 @@ smt_astt smtlib_convt::mk_xor(smt_astt a, smt_astt b)
 {
   assert(a->sort->id == SMT_SORT_BOOL && b->sort->id == SMT_SORT_BOOL);
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_XOR, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_XOR, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1222,7 +1249,7 @@ smt_astt smtlib_convt::mk_or(smt_astt a, smt_astt b)
 {
   assert(a->sort->id == SMT_SORT_BOOL && b->sort->id == SMT_SORT_BOOL);
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_OR, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_OR, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1232,7 +1259,7 @@ smt_astt smtlib_convt::mk_and(smt_astt a, smt_astt b)
 {
   assert(a->sort->id == SMT_SORT_BOOL && b->sort->id == SMT_SORT_BOOL);
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_AND, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_AND, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1242,7 +1269,7 @@ smt_astt smtlib_convt::mk_not(smt_astt a)
 {
   assert(a->sort->id == SMT_SORT_BOOL);
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_NOT, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_NOT, msg);
   ast->args.push_back(a);
   return ast;
 }
@@ -1252,7 +1279,7 @@ smt_astt smtlib_convt::mk_lt(smt_astt a, smt_astt b)
   assert(a->sort->id == SMT_SORT_INT || a->sort->id == SMT_SORT_REAL);
   assert(b->sort->id == SMT_SORT_INT || b->sort->id == SMT_SORT_REAL);
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_LT, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_LT, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1264,7 +1291,7 @@ smt_astt smtlib_convt::mk_bvult(smt_astt a, smt_astt b)
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVULT, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVULT, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1276,7 +1303,7 @@ smt_astt smtlib_convt::mk_bvslt(smt_astt a, smt_astt b)
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVSLT, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVSLT, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1287,7 +1314,7 @@ smt_astt smtlib_convt::mk_gt(smt_astt a, smt_astt b)
   assert(a->sort->id == SMT_SORT_INT || a->sort->id == SMT_SORT_REAL);
   assert(b->sort->id == SMT_SORT_INT || b->sort->id == SMT_SORT_REAL);
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_GT, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_GT, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1299,7 +1326,7 @@ smt_astt smtlib_convt::mk_bvugt(smt_astt a, smt_astt b)
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVUGT, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVUGT, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1311,7 +1338,7 @@ smt_astt smtlib_convt::mk_bvsgt(smt_astt a, smt_astt b)
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVUGT, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVUGT, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1322,7 +1349,7 @@ smt_astt smtlib_convt::mk_le(smt_astt a, smt_astt b)
   assert(a->sort->id == SMT_SORT_INT || a->sort->id == SMT_SORT_REAL);
   assert(b->sort->id == SMT_SORT_INT || b->sort->id == SMT_SORT_REAL);
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_LTE, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_LTE, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1334,7 +1361,7 @@ smt_astt smtlib_convt::mk_bvule(smt_astt a, smt_astt b)
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVULTE, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVULTE, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1346,7 +1373,7 @@ smt_astt smtlib_convt::mk_bvsle(smt_astt a, smt_astt b)
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVSLTE, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVSLTE, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1357,7 +1384,7 @@ smt_astt smtlib_convt::mk_ge(smt_astt a, smt_astt b)
   assert(a->sort->id == SMT_SORT_INT || a->sort->id == SMT_SORT_REAL);
   assert(b->sort->id == SMT_SORT_INT || b->sort->id == SMT_SORT_REAL);
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_GTE, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_GTE, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1369,7 +1396,7 @@ smt_astt smtlib_convt::mk_bvuge(smt_astt a, smt_astt b)
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVUGTE, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVUGTE, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1381,7 +1408,7 @@ smt_astt smtlib_convt::mk_bvsge(smt_astt a, smt_astt b)
   assert(b->sort->id != SMT_SORT_INT && b->sort->id != SMT_SORT_REAL);
   assert(a->sort->get_data_width() == b->sort->get_data_width());
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVSGTE, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_BVSGTE, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1391,7 +1418,7 @@ smt_astt smtlib_convt::mk_eq(smt_astt a, smt_astt b)
 {
   assert(a->sort->get_data_width() == b->sort->get_data_width());
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_EQ, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_EQ, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1403,7 +1430,8 @@ smt_astt smtlib_convt::mk_store(smt_astt a, smt_astt b, smt_astt c)
   assert(a->sort->get_domain_width() == b->sort->get_data_width());
   assert(
     a->sort->get_range_sort()->get_data_width() == c->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, a->sort, SMT_FUNC_STORE, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_STORE, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   ast->args.push_back(c);
@@ -1414,7 +1442,8 @@ smt_astt smtlib_convt::mk_select(smt_astt a, smt_astt b)
 {
   assert(a->sort->id == SMT_SORT_ARRAY);
   assert(a->sort->get_domain_width() == b->sort->get_data_width());
-  smtlib_smt_ast *ast = new smtlib_smt_ast(this, b->sort, SMT_FUNC_SELECT, msg);
+  smtlib_smt_ast *ast =
+    new(this) smtlib_smt_ast(this, b->sort, SMT_FUNC_SELECT, msg);
   ast->args.push_back(a);
   ast->args.push_back(b);
   return ast;
@@ -1424,7 +1453,7 @@ smt_astt smtlib_convt::mk_real2int(smt_astt a)
 {
   assert(a->sort->id == SMT_SORT_REAL);
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, a->sort, SMT_FUNC_REAL2INT, msg);
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_REAL2INT, msg);
   ast->args.push_back(a);
   return ast;
 }
@@ -1433,7 +1462,7 @@ smt_astt smtlib_convt::mk_int2real(smt_astt a)
 {
   assert(a->sort->id == SMT_SORT_INT);
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, a->sort, SMT_FUNC_INT2REAL, msg);
+    new(this) smtlib_smt_ast(this, a->sort, SMT_FUNC_INT2REAL, msg);
   ast->args.push_back(a);
   return ast;
 }
@@ -1442,7 +1471,7 @@ smt_astt smtlib_convt::mk_isint(smt_astt a)
 {
   assert(a->sort->id == SMT_SORT_INT || a->sort->id == SMT_SORT_REAL);
   smtlib_smt_ast *ast =
-    new smtlib_smt_ast(this, boolean_sort, SMT_FUNC_IS_INT, msg);
+    new(this) smtlib_smt_ast(this, boolean_sort, SMT_FUNC_IS_INT, msg);
   ast->args.push_back(a);
   return ast;
 }
@@ -1467,41 +1496,41 @@ smtlib_convt::convert_array_of(smt_astt init_val, unsigned long domain_width)
 
 smt_sortt smtlib_convt::mk_bool_sort()
 {
-  return new smt_sort(SMT_SORT_BOOL, 1);
+  return new(this) smt_sort(SMT_SORT_BOOL, 1);
 }
 
 smt_sortt smtlib_convt::mk_real_sort()
 {
-  return new smt_sort(SMT_SORT_INT);
+  return new(this) smt_sort(SMT_SORT_INT);
 }
 
 smt_sortt smtlib_convt::mk_int_sort()
 {
-  return new smt_sort(SMT_SORT_REAL);
+  return new(this) smt_sort(SMT_SORT_REAL);
 }
 
 smt_sortt smtlib_convt::mk_bv_sort(std::size_t width)
 {
-  return new smt_sort(SMT_SORT_BV, width);
+  return new(this) smt_sort(SMT_SORT_BV, width);
 }
 
 smt_sortt smtlib_convt::mk_fbv_sort(std::size_t width)
 {
-  return new smt_sort(SMT_SORT_FIXEDBV, width);
+  return new(this) smt_sort(SMT_SORT_FIXEDBV, width);
 }
 
 smt_sortt smtlib_convt::mk_array_sort(smt_sortt domain, smt_sortt range)
 {
-  return new smt_sort(
+  return new(this) smt_sort(
     SMT_SORT_ARRAY, domain->get_data_width(), range->get_data_width());
 }
 
 smt_sortt smtlib_convt::mk_bvfp_sort(std::size_t ew, std::size_t sw)
 {
-  return new smt_sort(SMT_SORT_BVFP, ew + sw + 1, sw + 1);
+  return new(this) smt_sort(SMT_SORT_BVFP, ew + sw + 1, sw + 1);
 }
 
 smt_sortt smtlib_convt::mk_bvfp_rm_sort()
 {
-  return new smt_sort(SMT_SORT_BVFP_RM, 3);
+  return new(this) smt_sort(SMT_SORT_BVFP_RM, 3);
 }
@@ -36,6 +36,33 @@ smt_convt *create_new_z3_solver(
   return conv;
 }
 
+static z3::tactic
+mk_tactic(z3::context &ctx, const optionst &options, const messaget &msg)
+{
+  // Comma separated list of tactics, applied in sequence
+  std::string tactics = options.get_option("z3-tactic");
+  if(tactics.empty())
+    tactics = "simplify,solve-eqs,simplify,smt";
+
+  std::istringstream in(tactics);
+  std::string name;
+  std::getline(in, name, ',');
+  try
+  {
+    z3::tactic t(ctx, name.c_str());
+    while(std::getline(in, name, ','))
+      t = t & z3::tactic(ctx, name.c_str());
+
+    return t;
+  }
+  catch(z3::exception &e)
+  {
+    msg.error(fmt::format(
+      "Invalid Z3 tactic \"{}\" in \"{}\": {}", name, tactics, e.msg()));
+    abort();
+  }
+}
+
 z3_convt::z3_convt(
   const namespacet &_ns,
   const optionst &_options,
@@ -44,9 +71,7 @@ z3_convt::z3_convt(
     array_iface(true, true),
     fp_convt(this, msg),
     z3_ctx(),
-    solver((z3::tactic(z3_ctx, "simplify") & z3::tactic(z3_ctx, "solve-eqs") &
-            z3::tactic(z3_ctx, "simplify") & z3::tactic(z3_ctx, "smt"))
-             .mk_solver())
+    solver(mk_tactic(z3_ctx, _options, msg).mk_solver())
 {
   z3::params p(z3_ctx);
   p.set("relevancy", 0U);
@@ -946,7 +971,7 @@ smt_sortt z3_convt::mk_struct_sort(const type2tc &type)
       &mk_tuple_decl,
       proj_decls.ptr()));
 
-  return new solver_smt_sort<z3::sort>(SMT_SORT_STRUCT, sort, type);
+  return new(this) solver_smt_sort<z3::sort>(SMT_SORT_STRUCT, sort, type);
 }
 
 smt_astt z3_smt_ast::update(
@@ -1378,13 +1403,13 @@ smt_sortt z3_convt::mk_fpbv_sort(const unsigned ew, const unsigned sw)
 {
   // We need to add an extra bit to the significand size,
   // as it has no hidden bit
-  return new solver_smt_sort<z3::sort>(
+  return new(this) solver_smt_sort<z3::sort>(
     SMT_SORT_FPBV, z3_ctx.fpa_sort(ew, sw + 1), ew + sw + 1, sw + 1);
 }
 
 smt_sortt z3_convt::mk_fpbv_rm_sort()
 {
-  return new solver_smt_sort<z3::sort>(
+  return new(this) solver_smt_sort<z3::sort>(
     SMT_SORT_FPBV_RM,
     z3::sort(z3_ctx, Z3_mk_fpa_rounding_mode_sort(z3_ctx)),
     3);
@@ -1392,39 +1417,41 @@ smt_sortt z3_convt::mk_fpbv_rm_sort()
 
 smt_sortt z3_convt::mk_bvfp_sort(std::size_t ew, std::size_t sw)
 {
-  return new solver_smt_sort<z3::sort>(
+  return new(this) solver_smt_sort<z3::sort>(
     SMT_SORT_BVFP, z3_ctx.bv_sort(ew + sw + 1), ew + sw + 1, sw + 1);
 }
 
 smt_sortt z3_convt::mk_bvfp_rm_sort()
 {
-  return new solver_smt_sort<z3::sort>(SMT_SORT_BVFP_RM, z3_ctx.bv_sort(3), 3);
+  return new(this) solver_smt_sort<z3::sort>(
+    SMT_SORT_BVFP_RM, z3_ctx.bv_sort(3), 3);
 }
 
 smt_sortt z3_convt::mk_bool_sort()
 {
-  return new solver_smt_sort<z3::sort>(SMT_SORT_BOOL, z3_ctx.bool_sort(), 1);
+  return new(this) solver_smt_sort<z3::sort>(
+    SMT_SORT_BOOL, z3_ctx.bool_sort(), 1);
 }
 
 smt_sortt z3_convt::mk_real_sort()
 {
-  return new solver_smt_sort<z3::sort>(SMT_SORT_REAL, z3_ctx.real_sort());
+  return new(this) solver_smt_sort<z3::sort>(SMT_SORT_REAL, z3_ctx.real_sort());
 }
 
 smt_sortt z3_convt::mk_int_sort()
 {
-  return new solver_smt_sort<z3::sort>(SMT_SORT_INT, z3_ctx.int_sort());
+  return new(this) solver_smt_sort<z3::sort>(SMT_SORT_INT, z3_ctx.int_sort());
 }
 
 smt_sortt z3_convt::mk_bv_sort(std::size_t width)
 {
-  return new solver_smt_sort<z3::sort>(
+  return new(this) solver_smt_sort<z3::sort>(
     SMT_SORT_BV, z3_ctx.bv_sort(width), width);
 }
 
 smt_sortt z3_convt::mk_fbv_sort(std::size_t width)
 {
-  return new solver_smt_sort<z3::sort>(
+  return new(this) solver_smt_sort<z3::sort>(
     SMT_SORT_FIXEDBV, z3_ctx.bv_sort(width), width);
 }
 
@@ -1434,7 +1461,7 @@ smt_sortt z3_convt::mk_array_sort(smt_sortt domain, smt_sortt range)
   auto range_sort = to_solver_smt_sort<z3::sort>(range);
 
   auto t = z3_ctx.array_sort(domain_sort->s, range_sort->s);
-  return new solver_smt_sort<z3::sort>(
+  return new(this) solver_smt_sort<z3::sort>(
     SMT_SORT_ARRAY, t, domain->get_data_width(), range);
 }
 
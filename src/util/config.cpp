@@ -101,6 +101,8 @@ bool configt::set(const cmdlinet &cmdline, const messaget &msg)
 {
   if(cmdline.isset("function"))
     main = cmdline.getval("function");
+  else if(cmdline.isset("enforce-contract"))
+    main = cmdline.getval("enforce-contract");
 
   if(cmdline.isset("define"))
     ansi_c.defines = cmdline.get_values("define");
@@ -7,6 +7,10 @@ Author: Daniel Kroening, kroening@kroening.com
 \*******************************************************************/
 
 #include <cassert>
+#include <cfenv>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
 #include <limits>
 #include <util/arith_tools.h>
 #include <util/ieee_float.h>
@@ -319,6 +323,12 @@ void ieee_floatt::unpack(const BigInt &i)
   assert(spec.f != 0);
   assert(spec.e != 0);
 
+  if(is_hardware_format() && i.is_uint64())
+  {
+    unpack_native(i.to_uint64());
+    return;
+  }
+
   {
     BigInt tmp = i;
 
@@ -371,6 +381,10 @@ bool ieee_floatt::is_normal() const
 
 BigInt ieee_floatt::pack() const
 {
+  uint64_t bits;
+  if(is_hardware_format() && pack_native(bits))
+    return BigInt(bits);
+
   BigInt result = 0;
 
   // sign bit
@@ -700,6 +714,9 @@ ieee_floatt &ieee_floatt::operator/=(const ieee_floatt &other)
 {
   assert(other.spec.f == spec.f);
 
+  if(native_op(other, '/'))
+    return *this;
+
   // NaN/x = NaN
   if(NaN_flag)
     return *this;
@@ -773,6 +790,9 @@ ieee_floatt &ieee_floatt::operator*=(const ieee_floatt &other)
 {
   assert(other.spec.f == spec.f);
 
+  if(native_op(other, '*'))
+    return *this;
+
   if(other.NaN_flag)
     make_NaN();
   if(NaN_flag)
@@ -811,6 +831,9 @@ ieee_floatt &ieee_floatt::operator+=(const ieee_floatt &other)
 
   assert(_other.spec == spec);
 
+  if(native_op(other, '+'))
+    return *this;
+
   if(other.NaN_flag)
     make_NaN();
   if(NaN_flag)
@@ -1126,6 +1149,175 @@ void ieee_floatt::from_float(const float f)
   unpack(u.i);
 }
 
+bool ieee_floatt::is_hardware_format() const
+{
+  return is_float() || is_double();
+}
+
+// Same as the BigInt path of unpack(), for formats that fit in 64 bits
+void ieee_floatt::unpack_native(uint64_t i)
+{
+  const uint64_t max_exp = (uint64_t(1) << spec.e) - 1;
+  const int64_t bias = (int64_t(1) << (spec.e - 1)) - 1;
+  uint64_t frac = i & ((uint64_t(1) << spec.f) - 1);
+  uint64_t exp = (i >> spec.f) & max_exp;
+  sign_flag = (i >> (spec.f + spec.e)) != 0;
+
+  NaN_flag = false;
+  infinity_flag = false;
+  if(exp == max_exp && frac != 0)
+    make_NaN();
+  else if(exp == max_exp) // Infinity
+  {
+    infinity_flag = true;
+    exponent = BigInt(exp);
+    fraction = 0;
+  }
+  else if(exp == 0 && frac == 0) // zero
+  {
+    exponent = 0;
+    fraction = 0;
+  }
+  else if(exp == 0) // denormal
+  {
+    exponent = BigInt(-bias + 1);
+    fraction = BigInt(frac);
+  }
+  else // normal
+  {
+    exponent = BigInt(int64_t(exp) - bias);
+    fraction = BigInt(frac + (uint64_t(1) << spec.f));
+  }
+}
+
+// Same as the BigInt path of pack(), for formats that fit in 64 bits. Fails
+// if the fraction or exponent are out of range for the format, which leaves
+// it to the general code to deal with.
+bool ieee_floatt::pack_native(uint64_t &result) const
+{
+  const uint64_t max_exp = (uint64_t(1) << spec.e) - 1;
+  const int64_t bias = (int64_t(1) << (spec.e - 1)) - 1;
+  const uint64_t hidden = uint64_t(1) << spec.f;
+
+  result = sign_flag ? uint64_t(1) << (spec.e + spec.f) : 0;
+  if(NaN_flag)
+  {
+    result += (max_exp << spec.f) + 1;
+    return true;
+  }
+
+  if(infinity_flag)
+  {
+    result += max_exp << spec.f;
+    return true;
+  }
+
+  if(fraction.is_zero() && exponent.is_zero())
+    return true;
+
+  if(!fraction.is_uint64() || !exponent.is_int64())
+    return false;
+
+  uint64_t frac = fraction.to_uint64();
+  int64_t exp = exponent.to_int64() + bias;
+  if(frac >= (hidden << 1))
+    return false;
+
+  if(frac >= hidden) // normal
+  {
+    if(exp < 1 || uint64_t(exp) >= max_exp)
+      return false;
+    result += (frac - hidden) + (uint64_t(exp) << spec.f);
+  }
+  else // denormal, the exponent is zero
+    result += frac;
+
+  return true;
+}
+
+static int native_rounding_mode(ieee_floatt::rounding_modet mode)
+{
+  switch(mode)
+  {
+  case ieee_floatt::ROUND_TO_EVEN:
+    return FE_TONEAREST;
+  case ieee_floatt::ROUND_TO_PLUS_INF:
+    return FE_UPWARD;
+  case ieee_floatt::ROUND_TO_MINUS_INF:
+    return FE_DOWNWARD;
+  case ieee_floatt::ROUND_TO_ZERO:
+    return FE_TOWARDZERO;
+  default:
+    return -1;
+  }
+}
+
+template <typename T>
+static T native_apply(T a, T b, char op)
+{
+  // volatile stops the compiler folding this under the default rounding mode
+  volatile T x = a, y = b;
+  switch(op)
+  {
+  case '+':
+    return x + y;
+  case '*':
+    return x * y;
+  case '/':
+    return x / y;
+  default:
+    assert(0 && "Unexpected floating-point operation");
+    return x;
+  }
+}
+
+bool ieee_floatt::native_op(const ieee_floatt &other, char op)
+{
+#if FLT_EVAL_METHOD != 0
+  // Excess precision (x87) would round twice
+  (void)other;
+  (void)op;
+  return false;
+#else
+  if(!is_hardware_format() || spec != other.spec)
+    return false;
+
+  // The unpacked representation doesn't keep NaN payloads or signs the way
+  // the host does, so anything involving them goes the general way
+  if(NaN_flag || other.NaN_flag)
+    return false;
+
+  int mode = native_rounding_mode(rounding_mode);
+  if(mode < 0)
+    return false;
+
+  int old_mode = fegetround();
+  if(fesetround(mode) != 0)
+    return false;
+
+  bool res = true;
+  if(is_float())
+  {
+    float r = native_apply(to_float(), other.to_float(), op);
+    if(std::isnan(r))
+      res = false;
+    else
+      from_float(r);
+  }
+  else
+  {
+    double r = native_apply(to_double(), other.to_double(), op);
+    if(std::isnan(r))
+      res = false;
+    else
+      from_double(r);
+  }
+
+  fesetround(old_mode);
+  return res;
+#endif
+}
+
 void ieee_floatt::make_NaN()
 {
   NaN_flag = true;
@@ -1176,7 +1368,7 @@ double ieee_floatt::to_double() const
   union
   {
     double f;
-    unsigned int i;
+    uint64_t i;
   } a;
 
   if(infinity_flag)
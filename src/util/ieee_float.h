@@ -296,6 +296,15 @@ protected:
   void align();
   void next_representable(bool greater);
 
+  // Fast paths for binary32 and binary64, which the host implements: these
+  // work on native integers and floating-point numbers rather than BigInts.
+  bool is_hardware_format() const;
+  void unpack_native(uint64_t i);
+  bool pack_native(uint64_t &result) const;
+  /** Perform "this op= other" with the host's arithmetic, if the format and
+   *  rounding mode allow. Returns false if the general code has to do it. */
+  bool native_op(const ieee_floatt &other, char op);
+
   // we store the number unpacked
   bool sign_flag;
   BigInt exponent; // this is unbiased
@@ -50,16 +50,17 @@ void irept::detatch()
   {
     data = new dt;
   }
-  else if(data->ref_count > 1)
+  else if(data->ref_count.get() > 1)
   {
     dt *old_data(data);
     data = new dt(*old_data);
 
-    data->ref_count = 1;
+    // The copy starts out unreferenced
+    data->ref_count.incr();
     remove_ref(old_data);
   }
 
-  assert(data->ref_count == 1);
+  assert(data->ref_count.get() == 1);
 }
 #endif
 
@@ -79,10 +80,9 @@ void irept::remove_ref(dt *old_data)
   if(old_data == nullptr)
     return;
 
-  assert(old_data->ref_count != 0);
+  assert(old_data->ref_count.get() != 0);
 
-  old_data->ref_count--;
-  if(old_data->ref_count == 0)
+  if(old_data->ref_count.decr())
   {
     delete old_data;
   }
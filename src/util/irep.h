@@ -19,6 +19,7 @@ Author: Daniel Kroening, kroening@kroening.com
 #define SHARING
 
 #include <util/dstring.h>
+#include <util/irep_sharing.h>
 
 typedef dstring irep_idt;
 typedef dstring irep_namet;
@@ -73,8 +74,8 @@ public:
   {
     if(data != nullptr)
     {
-      assert(data->ref_count != 0);
-      data->ref_count++;
+      assert(data->ref_count.get() != 0);
+      data->ref_count.incr();
     }
   }
 
@@ -85,7 +86,7 @@ public:
     tmp = data;
     data = irep.data;
     if(data != nullptr)
-      data->ref_count++;
+      data->ref_count.incr();
     remove_ref(tmp);
     return *this;
   }
@@ -1252,7 +1253,7 @@ public:
   {
   public:
 #ifdef SHARING
-    unsigned ref_count;
+    irep_refcountt ref_count;
 #endif
 
     dstring data;
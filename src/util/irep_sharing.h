@@ -0,0 +1,106 @@
+/*******************************************************************\
+
+Module: Sharing ireps between threads
+
+\*******************************************************************/
+
+#ifndef CPROVER_UTIL_IREP_SHARING_H
+#define CPROVER_UTIL_IREP_SHARING_H
+
+#include <atomic>
+#include <cassert>
+
+/** Whether ireps, irep2 nodes and the string table are currently in use by
+ *  more than one thread. Nearly every run is single threaded, and shouldn't
+ *  pay for synchronisation it doesn't need: the reference counts and the
+ *  string table only synchronise while this is set. Code that starts
+ *  threads working on shared ireps sets it, through irep_sharing_scopet,
+ *  before starting them and until they have all been joined. */
+class irep_sharingt
+{
+public:
+  static bool active()
+  {
+    return flag().load(std::memory_order_relaxed);
+  }
+
+protected:
+  friend class irep_sharing_scopet;
+
+  static std::atomic<bool> &flag()
+  {
+    static std::atomic<bool> f(false);
+    return f;
+  }
+};
+
+/** Sets irep_sharingt::active() for as long as it lives. Creating and
+ *  joining threads orders the change with respect to them. */
+class irep_sharing_scopet
+{
+public:
+  irep_sharing_scopet()
+  {
+    assert(!irep_sharingt::active() && "irep sharing scopes don't nest");
+    irep_sharingt::flag().store(true);
+  }
+
+  ~irep_sharing_scopet()
+  {
+    irep_sharingt::flag().store(false);
+  }
+
+  irep_sharing_scopet(const irep_sharing_scopet &) = delete;
+  irep_sharing_scopet &operator=(const irep_sharing_scopet &) = delete;
+};
+
+/** Reference count embedded in shared irep data. It is only updated with
+ *  atomic read-modify-write operations while irep_sharingt::active(); the
+ *  relaxed loads and stores used otherwise cost no more than plain ones.
+ *  Copying the data yields a new, unreferenced object, hence the copy
+ *  operations deliberately leave the count alone. */
+class irep_refcountt
+{
+public:
+  explicit irep_refcountt(unsigned int n = 0) : count(n)
+  {
+  }
+
+  irep_refcountt(const irep_refcountt &) : count(0)
+  {
+  }
+
+  irep_refcountt &operator=(const irep_refcountt &)
+  {
+    return *this;
+  }
+
+  void incr()
+  {
+    if(irep_sharingt::active())
+      count.fetch_add(1, std::memory_order_relaxed);
+    else
+      count.store(get() + 1, std::memory_order_relaxed);
+  }
+
+  /** Returns true when the last reference has gone away */
+  bool decr()
+  {
+    if(irep_sharingt::active())
+      return count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+
+    unsigned int c = get() - 1;
+    count.store(c, std::memory_order_relaxed);
+    return c == 0;
+  }
+
+  unsigned int get() const
+  {
+    return count.load(std::memory_order_relaxed);
+  }
+
+protected:
+  std::atomic<unsigned int> count;
+};
+
+#endif
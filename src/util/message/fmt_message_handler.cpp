@@ -6,6 +6,9 @@ void fmt_message_handler::print(
   const std::string &message) const
 {
   fmt::print(files.at(level), "{}\n", message);
+  // Errors are often the last thing printed before an abort()
+  if(level == VerbosityLevel::Error)
+    fflush(files.at(level));
 }
 
 fmt_message_handler::fmt_message_handler()
@@ -27,4 +30,73 @@ void fmt_message_handler::initialize(FILE *out, FILE *err)
   files[VerbosityLevel::Progress] = out;
   files[VerbosityLevel::Status] = out;
   files[VerbosityLevel::Debug] = out;
-}
\ No newline at end of file
+}
+
+async_fmt_message_handler::async_fmt_message_handler(FILE *out, FILE *err)
+  : fmt_message_handler(out, err)
+{
+  writer = std::thread(&async_fmt_message_handler::run, this);
+}
+
+async_fmt_message_handler::~async_fmt_message_handler()
+{
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    stopping = true;
+  }
+  pending.notify_one();
+  writer.join();
+}
+
+void async_fmt_message_handler::print(
+  VerbosityLevel level,
+  const std::string &message) const
+{
+  if(level == VerbosityLevel::Error)
+  {
+    flush();
+    fmt_message_handler::print(level, message);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    queue.emplace_back(level, message);
+  }
+  pending.notify_one();
+}
+
+void async_fmt_message_handler::flush() const
+{
+  std::unique_lock<std::mutex> guard(lock);
+  drained.wait(guard, [this]() { return queue.empty() && !writing; });
+}
+
+void async_fmt_message_handler::run()
+{
+  std::unique_lock<std::mutex> guard(lock);
+  for(;;)
+  {
+    pending.wait(guard, [this]() { return stopping || !queue.empty(); });
+    if(queue.empty())
+      break;
+
+    // Write a whole batch without holding the lock, so that printing
+    // never waits on the output
+    std::deque<std::pair<VerbosityLevel, std::string>> batch;
+    batch.swap(queue);
+    writing = true;
+    guard.unlock();
+
+    for(const auto &m : batch)
+      fmt_message_handler::print(m.first, m.second);
+    for(const auto &f : files)
+      if(f.second != nullptr)
+        fflush(f.second);
+
+    guard.lock();
+    writing = false;
+    if(queue.empty())
+      drained.notify_all();
+  }
+}
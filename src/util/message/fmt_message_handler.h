@@ -5,6 +5,10 @@ Author: Rafael Sá Menezes, rafael.sa.menezes@outlook.com
 
 \*******************************************************************/
 #pragma once
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <util/message/message_handler.h>
 
 /**
@@ -22,4 +26,44 @@ public:
 
 private:
   void initialize(FILE *out, FILE *err);
-};
\ No newline at end of file
+};
+
+/**
+ * @brief fmt_message_handler that hands messages over to a background
+ * thread to be written, so that whoever prints doesn't wait on the output.
+ *
+ * Messages are written in the order they were printed. Errors are written
+ * synchronously, after everything queued before them, as they are usually
+ * followed by an abort(). Everything else is written by the time flush()
+ * returns or the handler is destroyed.
+ *
+ * The writer thread doesn't survive a fork(), so this must not be used by
+ * processes that fork and keep printing in the child.
+ */
+class async_fmt_message_handler : public fmt_message_handler
+{
+public:
+  async_fmt_message_handler(FILE *out, FILE *err);
+  ~async_fmt_message_handler();
+
+  virtual void
+  print(VerbosityLevel level, const std::string &message) const override;
+
+  /**
+   * @brief Wait until every message printed so far has been written
+   */
+  void flush() const;
+
+private:
+  void run();
+
+  mutable std::mutex lock;
+  // Signalled when there are messages to write or when stopping
+  mutable std::condition_variable pending;
+  // Signalled when the writer has written everything queued
+  mutable std::condition_variable drained;
+  mutable std::deque<std::pair<VerbosityLevel, std::string>> queue;
+  mutable bool writing = false;
+  bool stopping = false;
+  std::thread writer;
+};
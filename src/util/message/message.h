@@ -10,6 +10,7 @@ Maintainers:
 \*******************************************************************/
 #pragma once
 
+#include <fmt/core.h>
 #include <memory>
 #include <util/message/message_handler.h>
 #include <util/location.h>
@@ -112,6 +113,56 @@ public:
     print(VerbosityLevel::Debug, message, location);
   }
 
+  /**
+   * @brief Whether messages of a level would be printed at all. Messages
+   * that are costly to build (e.g. through a std::ostringstream) should be
+   * guarded by this, so that nothing is paid for them when they are dropped
+   *
+   * @param level verbosity level of the message
+   */
+  bool is_enabled(VerbosityLevel level) const
+  {
+    return level <= verbosity;
+  }
+
+  // Formatting variants of the functions above. The arguments are only
+  // formatted, with fmt::format, if the message is going to be printed.
+
+  template <typename... Args>
+  void error_fmt(const char *format, const Args &... args) const
+  {
+    if(is_enabled(VerbosityLevel::Error))
+      error(fmt::format(format, args...));
+  }
+
+  template <typename... Args>
+  void warning_fmt(const char *format, const Args &... args) const
+  {
+    if(is_enabled(VerbosityLevel::Warning))
+      warning(fmt::format(format, args...));
+  }
+
+  template <typename... Args>
+  void result_fmt(const char *format, const Args &... args) const
+  {
+    if(is_enabled(VerbosityLevel::Result))
+      result(fmt::format(format, args...));
+  }
+
+  template <typename... Args>
+  void status_fmt(const char *format, const Args &... args) const
+  {
+    if(is_enabled(VerbosityLevel::Status))
+      status(fmt::format(format, args...));
+  }
+
+  template <typename... Args>
+  void debug_fmt(const char *format, const Args &... args) const
+  {
+    if(is_enabled(VerbosityLevel::Debug))
+      debug(fmt::format(format, args...));
+  }
+
   /**
    * @brief Set the verbosity level
    *
@@ -22,7 +22,9 @@
 // down.
 namespacet *migrate_namespace_lookup = nullptr;
 
-static std::map<irep_idt, BigInt> bin2int_map_signed, bin2int_map_unsigned;
+// Per thread, as the parallel analyses migrate constants too
+static thread_local std::map<irep_idt, BigInt> bin2int_map_signed,
+  bin2int_map_unsigned;
 
 const BigInt &binary2bigint(irep_idt binary, bool is_signed)
 {
@@ -49,12 +49,10 @@ expr2tc expr2t::simplify() const
     bool changed = false;
     std::list<expr2tc> newoperands;
 
-    for(unsigned int idx = 0; idx < get_num_sub_exprs(); idx++)
-    {
-      const expr2tc *e = get_sub_expr(idx);
+    foreach_operand([&changed, &newoperands](const expr2tc &e) {
       expr2tc tmp;
 
-      if(!is_nil_expr(*e))
+      if(!is_nil_expr(e))
       {
         tmp = e->simplify();
         if(!is_nil_expr(tmp))
@@ -62,7 +60,7 @@ expr2tc expr2t::simplify() const
       }
 
       newoperands.push_back(tmp);
-    }
+    });
 
     if(changed == false)
       // Second shot at simplification. For efficiency, a simplifier may be
@@ -929,6 +927,25 @@ expr2tc index2t::do_simplify() const
   expr2tc new_index = try_simplification(index);
   expr2tc src = try_simplification(source_value);
 
+  // Constant updates to other constant indexes don't matter to this one
+  if(is_constant_int2t(new_index))
+  {
+    const BigInt &idx = to_constant_int2t(new_index).value;
+    while(is_with2t(src))
+    {
+      const with2t &w = to_with2t(src);
+      if(!is_constant_int2t(w.update_field))
+        break;
+
+      if(to_constant_int2t(w.update_field).value == idx)
+        return w.update_value;
+
+      // w lives in src, take a reference to what's below it first
+      expr2tc below = w.source_value;
+      src = below;
+    }
+  }
+
   if(is_with2t(src))
   {
     // Index is the same as an update to the thing we're indexing; we can
@@ -936,6 +953,9 @@ expr2tc index2t::do_simplify() const
     if(new_index == to_with2t(src).update_field)
       return to_with2t(src).update_value;
 
+    if(src != source_value || new_index != index)
+      return index2tc(type, src, new_index);
+
     return expr2tc();
   }
 
@@ -25,6 +25,10 @@ bool string_ptrt::operator==(const string_ptrt &other) const
 
 unsigned string_containert::get(const char *s)
 {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex, std::defer_lock);
+  if(irep_sharingt::active())
+    lock.lock();
+
   string_ptrt string_ptr(s);
 
   hash_tablet::iterator it = hash_table.find(string_ptr);
@@ -48,6 +52,10 @@ unsigned string_containert::get(const char *s)
 
 unsigned string_containert::get(const std::string &s)
 {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex, std::defer_lock);
+  if(irep_sharingt::active())
+    lock.lock();
+
   string_ptrt string_ptr(s);
 
   hash_tablet::iterator it = hash_table.find(string_ptr);
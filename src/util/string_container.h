@@ -11,8 +11,11 @@ Author: Daniel Kroening, kroening@kroening.com
 
 #include <cassert>
 #include <list>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <string>
+#include <util/irep_sharing.h>
 #include <vector>
 
 struct string_ptrt
@@ -66,13 +69,17 @@ public:
   // the pointer is guaranteed to be stable
   const char *c_str(size_t no) const
   {
-    assert(no < string_vector.size());
-    return string_vector[no]->c_str();
+    return get_string(no).c_str();
   }
 
   // the reference is guaranteed to be stable
   const std::string &get_string(size_t no) const
   {
+    // The vector may be growing in another thread
+    std::shared_lock<std::shared_timed_mutex> lock(mutex, std::defer_lock);
+    if(irep_sharingt::active())
+      lock.lock();
+
     assert(no < string_vector.size());
     return *string_vector[no];
   }
@@ -89,6 +96,9 @@ protected:
 
   typedef std::vector<std::string *> string_vectort;
   string_vectort string_vector;
+
+  // Only taken while irep_sharingt::active()
+  mutable std::shared_timed_mutex mutex;
 };
 
 inline string_containert &get_string_container()
@@ -13,6 +13,7 @@
 #include <util/std_types.h>
 #include <util/type_byte_size.h>
 #include <util/message/format.h>
+#include <unordered_map>
 
 BigInt member_offset(const type2tc &type, const irep_idt &member)
 {
@@ -21,24 +22,94 @@ BigInt member_offset(const type2tc &type, const irep_idt &member)
 
 BigInt member_offset_bits(const type2tc &type, const irep_idt &member)
 {
-  BigInt result = 0;
-
   // empty union generate an array
   if(!is_struct_type(type))
-    return result;
+    return 0;
 
-  unsigned idx = 0;
+  const type_layoutt &layout = type_layout(type);
   const struct_type2t &thetype = to_struct_type(type);
-  for(auto const &it : thetype.members)
+  for(unsigned int idx = 0; idx < thetype.member_names.size(); idx++)
+  {
+    if(thetype.member_names[idx] == member)
+      return layout.offsets[idx];
+  }
+
+  return layout.size;
+}
+
+unsigned int type_layoutt::member_at(const BigInt &offset) const
+{
+  // The ends of the members of a struct are non-decreasing
+  unsigned int lo = 0, hi = offsets.size();
+  while(lo < hi)
   {
-    if(thetype.member_names[idx] == member.as_string())
-      break;
+    unsigned int mid = lo + (hi - lo) / 2;
+    if(offsets[mid] + sizes[mid] > offset)
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
 
-    result += type_byte_size_bits(it);
-    idx++;
+  return lo;
+}
+
+namespace
+{
+struct layout_hasht
+{
+  size_t operator()(const type2tc &t) const
+  {
+    // Unlike type2_hash, this uses the hash cached in the type
+    return t.crc();
   }
+};
 
-  return result;
+struct layout_eqt
+{
+  bool operator()(const type2tc &a, const type2tc &b) const
+  {
+    return a.get() == b.get() || a == b;
+  }
+};
+} // namespace
+
+const type_layoutt &type_layout(const type2tc &type)
+{
+  assert(is_struct_type(type) || is_union_type(type));
+
+  // Each thread keeps its own cache, as the parallel analyses compute sizes
+  // too. Layouts are returned by reference, so entries are never removed.
+  typedef std::unordered_map<type2tc, type_layoutt, layout_hasht, layout_eqt>
+    layout_cachet;
+  static thread_local layout_cachet cache;
+
+  auto it = cache.find(type);
+  if(it != cache.end())
+    return it->second;
+
+  // Members may be structs themselves, whose layout is cached on the way
+  const struct_union_data &data =
+    static_cast<const struct_union_data &>(*type);
+  type_layoutt layout;
+  layout.size = 0;
+  for(auto const &member : data.members)
+  {
+    BigInt size = type_byte_size_bits(member);
+    if(is_struct_type(type))
+    {
+      // Padding is explicit in the members, so they are simply consecutive
+      layout.offsets.push_back(layout.size);
+      layout.size += size;
+    }
+    else
+    {
+      layout.offsets.push_back(0);
+      layout.size = std::max(layout.size, size);
+    }
+    layout.sizes.push_back(size);
+  }
+
+  return cache.emplace(type, std::move(layout)).first->second;
 }
 
 BigInt type_byte_size_default(const type2tc &type, const BigInt &defaultval)
@@ -103,7 +174,8 @@ BigInt type_byte_size_bits(const type2tc &type)
       throw new array_type2t::inf_sized_array_excp();
 
     expr2tc arrsize = t2.array_size;
-    simplify(arrsize);
+    if(!is_constant_int2t(arrsize))
+      simplify(arrsize);
     if(!is_constant_int2t(arrsize))
       throw new array_type2t::dyn_sized_array_excp(arrsize);
 
@@ -113,29 +185,11 @@ BigInt type_byte_size_bits(const type2tc &type)
   }
 
   case type2t::struct_id:
-  {
-    // Compute the size of all members of this struct, and add padding bytes
-    // so that they all start on wourd boundries. Also add any trailing bytes
-    // necessary to make arrays align properly if malloc'd, see C89 6.3.3.4.
-    BigInt accumulated_size = 0;
-    for(auto const &it : to_struct_type(type).members)
-      accumulated_size += type_byte_size_bits(it);
-
-    // At the end of that, the tests above should have rounded accumulated size
-    // up to a size that contains the required trailing padding for array
-    // allocation alignment.
-    return accumulated_size;
-  }
-
+    // Padding bytes, including any trailing bytes necessary to make arrays
+    // align properly if malloc'd (see C89 6.3.3.4), are explicit members.
   case type2t::union_id:
-  {
-    // Very simple: the largest field size, rounded up to a word boundry for
-    // array allocation alignment.
-    BigInt max_size = 0;
-    for(auto const &it : to_union_type(type).members)
-      max_size = std::max(max_size, type_byte_size_bits(it));
-    return max_size;
-  }
+    // The largest field size, rounded up the same way.
+    return type_layout(type).size;
 
   default:
     assert(
@@ -15,6 +15,31 @@ Author: Daniel Kroening, kroening@kroening.com
 #include <util/namespace.h>
 #include <util/std_types.h>
 
+/** Bit layout of a struct or union type. These are computed once per type
+ *  and then kept for the rest of the run, so that walking the members of
+ *  deeply nested structs on every dereference doesn't cost a walk of the
+ *  whole type tree each time. */
+class type_layoutt
+{
+public:
+  /** Size of the whole type, as returned by type_byte_size_bits */
+  BigInt size;
+  /** Offset of each member, zero for all members of a union */
+  std::vector<BigInt> offsets;
+  /** Size of each member */
+  std::vector<BigInt> sizes;
+
+  /** Index of the first member of a struct that ends after the given bit
+   *  offset, i.e. the one containing it unless it lies past the end of the
+   *  struct, in which case the number of members is returned. Zero sized
+   *  members are never picked. */
+  unsigned int member_at(const BigInt &offset) const;
+};
+
+/** Layout of a struct or union type. Throws like type_byte_size_bits if any
+ *  of the members has no constant size. */
+const type_layoutt &type_layout(const type2tc &type);
+
 BigInt member_offset_bits(const type2tc &type, const irep_idt &member);
 BigInt member_offset(const type2tc &type, const irep_idt &member);
 
@@ -0,0 +1,277 @@
+/*******************************************************************\
+Module: Unit tests for smt_term_dagt
+
+\*******************************************************************/
+
+#define CATCH_CONFIG_MAIN // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch2/catch.hpp>
+#include <solvers/smt/smt_conv.h>
+#include <util/arith_tools.h>
+#include <util/config.h>
+#include <util/context.h>
+#include <util/namespace.h>
+
+/* A converter without a solver behind it: every term handed to the backend
+ * becomes a fresh AST, and is counted, so that the tests can tell which terms
+ * the DAG shared or folded away. */
+class dag_test_convt : public smt_convt
+{
+public:
+  dag_test_convt(
+    const namespacet &_ns,
+    const optionst &_opts,
+    const messaget &_msg)
+    : smt_convt(_ns, _opts, _msg)
+  {
+  }
+
+  unsigned int emitted = 0;
+
+  smt_astt fresh(smt_sortt s)
+  {
+    ++emitted;
+    return new(this) smt_ast(this, s, msg);
+  }
+
+  smt_astt mk_bv_symbol(std::size_t width)
+  {
+    return fresh(mk_bv_sort(width));
+  }
+
+  smt_astt mk_bool_symbol()
+  {
+    return fresh(mk_bool_sort());
+  }
+
+  smt_sortt mk_bool_sort() override
+  {
+    return new(this) smt_sort(SMT_SORT_BOOL);
+  }
+
+  smt_sortt mk_bv_sort(std::size_t width) override
+  {
+    return new(this) smt_sort(SMT_SORT_BV, width);
+  }
+
+  void assert_ast(smt_astt) override
+  {
+  }
+
+  resultt dec_solve() override
+  {
+    return P_ERROR;
+  }
+
+  const std::string solver_text() override
+  {
+    return "dag_test";
+  }
+
+  smt_astt mk_smt_int(const BigInt &) override
+  {
+    abort();
+  }
+
+  smt_astt mk_smt_real(const std::string &) override
+  {
+    abort();
+  }
+
+  using smt_convt::mk_smt_bv;
+  smt_astt mk_smt_bv(const BigInt &, smt_sortt s) override
+  {
+    return fresh(s);
+  }
+
+  smt_astt mk_smt_bool(bool) override
+  {
+    return fresh(mk_bool_sort());
+  }
+
+  smt_astt mk_smt_symbol(const std::string &, smt_sortt s) override
+  {
+    return fresh(s);
+  }
+
+  smt_astt mk_extract(smt_astt, unsigned int high, unsigned int low) override
+  {
+    return fresh(mk_bv_sort(high - low + 1));
+  }
+
+  smt_astt mk_sign_ext(smt_astt, unsigned int) override
+  {
+    abort();
+  }
+
+  smt_astt mk_zero_ext(smt_astt, unsigned int) override
+  {
+    abort();
+  }
+
+  smt_astt mk_concat(smt_astt a, smt_astt b) override
+  {
+    std::size_t w = a->sort->get_data_width() + b->sort->get_data_width();
+    return fresh(mk_bv_sort(w));
+  }
+
+  smt_astt mk_ite(smt_astt, smt_astt t, smt_astt) override
+  {
+    return fresh(t->sort);
+  }
+
+  smt_astt mk_not(smt_astt) override
+  {
+    return fresh(mk_bool_sort());
+  }
+
+  smt_astt mk_and(smt_astt, smt_astt) override
+  {
+    return fresh(mk_bool_sort());
+  }
+
+  smt_astt mk_or(smt_astt, smt_astt) override
+  {
+    return fresh(mk_bool_sort());
+  }
+
+  smt_astt mk_xor(smt_astt, smt_astt) override
+  {
+    return fresh(mk_bool_sort());
+  }
+
+  smt_astt mk_implies(smt_astt, smt_astt) override
+  {
+    return fresh(mk_bool_sort());
+  }
+
+  smt_astt mk_eq(smt_astt, smt_astt) override
+  {
+    return fresh(mk_bool_sort());
+  }
+
+  bool get_bool(smt_astt) override
+  {
+    abort();
+  }
+
+  BigInt get_bv(smt_astt, bool) override
+  {
+    abort();
+  }
+};
+
+SCENARIO("smt_term_dag", "[core][solvers][smt_term_dag]")
+{
+  messaget msg;
+  config.ansi_c.set_data_model(configt::ILP32);
+  contextt ctx(msg);
+  namespacet ns(ctx);
+  optionst opts;
+  dag_test_convt conv(ns, opts, msg);
+  smt_term_dagt &dag = conv.term_dag;
+
+  GIVEN("Two Boolean and two bit-vector symbols")
+  {
+    smt_astt p = conv.mk_bool_symbol();
+    smt_astt q = conv.mk_bool_symbol();
+    smt_astt x = conv.mk_bv_symbol(8);
+    smt_astt y = conv.mk_bv_symbol(8);
+    unsigned int before = conv.emitted;
+
+    THEN("Building the same term twice emits it once")
+    {
+      smt_astt a = dag.mk_and(p, q);
+      REQUIRE(dag.mk_and(p, q) == a);
+      REQUIRE(dag.mk_and(q, p) == a);
+      REQUIRE(dag.mk_eq(y, x) == dag.mk_eq(x, y));
+      REQUIRE(dag.mk_bv(BigInt(42), 8) == dag.mk_bv(BigInt(42), 8));
+      REQUIRE(conv.emitted == before + 3);
+    }
+
+    THEN("Terms differing in an operand or parameter are kept apart")
+    {
+      REQUIRE(dag.mk_and(p, q) != dag.mk_or(p, q));
+      REQUIRE(dag.mk_extract(x, 3, 0) != dag.mk_extract(x, 4, 1));
+      REQUIRE(dag.mk_bv(BigInt(1), 8) != dag.mk_bv(BigInt(1), 16));
+    }
+
+    THEN("Boolean terms with constant operands fold")
+    {
+      smt_astt t = dag.mk_bool(true);
+      smt_astt f = dag.mk_bool(false);
+      REQUIRE(dag.mk_and(t, p) == p);
+      REQUIRE(dag.mk_and(f, p) == f);
+      REQUIRE(dag.mk_or(p, t) == t);
+      REQUIRE(dag.mk_not(dag.mk_not(p)) == p);
+      REQUIRE(dag.mk_and(p, dag.mk_not(p)) == f);
+      REQUIRE(dag.mk_ite(t, p, q) == p);
+      REQUIRE(dag.mk_ite(q, p, p) == p);
+    }
+
+    THEN("Equalities between constants fold")
+    {
+      smt_astt t = dag.mk_bool(true);
+      smt_astt f = dag.mk_bool(false);
+      smt_astt three = dag.mk_bv(BigInt(3), 8);
+      REQUIRE(dag.mk_eq(three, dag.mk_bv(BigInt(3), 8)) == t);
+      REQUIRE(dag.mk_eq(three, dag.mk_bv(BigInt(4), 8)) == f);
+      REQUIRE(dag.mk_eq(x, x) == t);
+    }
+
+    THEN("Extracts and concats of the same vector are normalised")
+    {
+      REQUIRE(dag.mk_extract(x, 7, 0) == x);
+      smt_astt hi = dag.mk_extract(x, 7, 4);
+      smt_astt lo = dag.mk_extract(x, 3, 0);
+      REQUIRE(dag.mk_concat(hi, lo) == x);
+      REQUIRE(
+        dag.mk_extract(dag.mk_extract(x, 6, 1), 2, 1) ==
+        dag.mk_extract(x, 3, 2));
+      REQUIRE(
+        dag.mk_extract(dag.mk_concat(x, y), 11, 8) ==
+        dag.mk_extract(x, 3, 0));
+    }
+  }
+
+  GIVEN("Constants outside of [0, 2^w)")
+  {
+    THEN("Negative constants are the same term as their two's complement")
+    {
+      smt_astt m1 = dag.mk_bv(BigInt(-1), 8);
+      REQUIRE(dag.mk_bv(BigInt(255), 8) == m1);
+      REQUIRE(dag.mk_bv(BigInt(-257), 8) == m1);
+      REQUIRE(dag.mk_bv(BigInt(-128), 8) == dag.mk_bv(BigInt(128), 8));
+    }
+
+    THEN("Constants wider than the vector wrap around")
+    {
+      REQUIRE(dag.mk_bv(BigInt(256), 8) == dag.mk_bv(BigInt(0), 8));
+      REQUIRE(dag.mk_bv(BigInt(511), 8) == dag.mk_bv(BigInt(-1), 8));
+      REQUIRE(
+        dag.mk_eq(dag.mk_bv(BigInt(256), 8), dag.mk_bv(BigInt(0), 8)) ==
+        dag.mk_bool(true));
+    }
+
+    THEN("Constants wider than 64 bits are folded exactly")
+    {
+      BigInt two128 = power(2, 128);
+      smt_astt m1 = dag.mk_bv(BigInt(-1), 128);
+      REQUIRE(dag.mk_bv(two128 - 1, 128) == m1);
+      REQUIRE(dag.mk_bv(two128 * 3 - 1, 128) == m1);
+      REQUIRE(dag.mk_bv(two128, 128) == dag.mk_bv(BigInt(0), 128));
+      REQUIRE(
+        dag.mk_eq(m1, dag.mk_bv(two128 - 2, 128)) == dag.mk_bool(false));
+      REQUIRE(
+        dag.mk_extract(m1, 127, 64) == dag.mk_bv(power(2, 64) - 1, 64));
+    }
+
+    THEN("Concatenated and extracted constants are folded")
+    {
+      smt_astt c =
+        dag.mk_concat(dag.mk_bv(BigInt(-1), 4), dag.mk_bv(BigInt(0), 4));
+      REQUIRE(c == dag.mk_bv(BigInt(0xf0), 8));
+      REQUIRE(dag.mk_extract(c, 7, 4) == dag.mk_bv(BigInt(15), 4));
+      REQUIRE(dag.mk_extract(c, 3, 0) == dag.mk_bv(BigInt(0), 4));
+    }
+  }
+}
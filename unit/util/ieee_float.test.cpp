@@ -0,0 +1,111 @@
+/*******************************************************************\
+Module: Unit tests for ieee_floatt
+
+\*******************************************************************/
+
+#define CATCH_CONFIG_MAIN // This tells Catch to provide a main() - only do this in one cpp file
+#include <catch2/catch.hpp>
+#include <cfenv>
+#include <cmath>
+#include <limits>
+#include <util/ieee_float.h>
+
+TEST_CASE("binary32 values survive unpack and pack", "[core][util][ieee_float]")
+{
+  const float values[] = {
+    0.0f,
+    -0.0f,
+    1.0f,
+    -2.5f,
+    0.1f,
+    std::numeric_limits<float>::min(),
+    std::numeric_limits<float>::denorm_min(),
+    std::numeric_limits<float>::max(),
+    std::numeric_limits<float>::infinity(),
+    -std::numeric_limits<float>::infinity()};
+
+  for(float v : values)
+  {
+    ieee_floatt f;
+    f.from_float(v);
+    REQUIRE(f.to_float() == v);
+    REQUIRE(std::signbit(f.to_float()) == std::signbit(v));
+  }
+}
+
+TEST_CASE("binary64 values survive unpack and pack", "[core][util][ieee_float]")
+{
+  const double values[] = {
+    0.0,
+    -0.0,
+    1.0,
+    1.0 / 3.0,
+    std::numeric_limits<double>::min(),
+    std::numeric_limits<double>::denorm_min(),
+    std::numeric_limits<double>::max(),
+    std::numeric_limits<double>::infinity()};
+
+  for(double v : values)
+  {
+    ieee_floatt f;
+    f.from_double(v);
+    REQUIRE(f.to_double() == v);
+  }
+}
+
+TEST_CASE(
+  "binary64 arithmetic follows the rounding mode",
+  "[core][util][ieee_float]")
+{
+  ieee_floatt one, three;
+  one.from_double(1.0);
+  three.from_double(3.0);
+
+  ieee_floatt up = one;
+  up.rounding_mode = ieee_floatt::ROUND_TO_PLUS_INF;
+  up /= three;
+
+  ieee_floatt down = one;
+  down.rounding_mode = ieee_floatt::ROUND_TO_MINUS_INF;
+  down /= three;
+
+  REQUIRE(down < up);
+  REQUIRE(std::nextafter(down.to_double(), 1.0) == up.to_double());
+  REQUIRE(fegetround() == FE_TONEAREST);
+}
+
+TEST_CASE(
+  "binary32 arithmetic matches the host",
+  "[core][util][ieee_float]")
+{
+  ieee_floatt a, b;
+  a.from_float(0.1f);
+  b.from_float(0.2f);
+
+  ieee_floatt sum = a;
+  sum += b;
+  REQUIRE(sum.to_float() == 0.1f + 0.2f);
+
+  ieee_floatt prod = a;
+  prod *= b;
+  REQUIRE(prod.to_float() == 0.1f * 0.2f);
+
+  ieee_floatt diff = a;
+  diff -= a;
+  REQUIRE(diff.is_zero());
+}
+
+TEST_CASE(
+  "other formats still use the general code",
+  "[core][util][ieee_float]")
+{
+  ieee_floatt one(ieee_float_spect::quadruple_precision());
+  one.from_integer(1);
+  ieee_floatt three(ieee_float_spect::quadruple_precision());
+  three.from_integer(3);
+
+  ieee_floatt third = one;
+  third /= three;
+  third *= three;
+  REQUIRE(third == one);
+}